@@ -40,18 +40,41 @@
 ;   <o> Stack Size (in Bytes) <0x0-0xFFFFFFFF:8>
 ; </h>
 
-Stack_Size      EQU     0x00000400
+; main stack: thread mode runs on PSP (placed at the bottom of SRAM by KickScooter.sct)
+Stack_Size      EQU     0x00000300
 
                 AREA    STACK, NOINIT, READWRITE, ALIGN=3
 Stack_Mem       SPACE   Stack_Size
+__initial_psp
+
+; <h> ISR Stack Configuration
+;   <o> ISR Stack Size (in Bytes) <0x0-0xFFFFFFFF:8>
+; </h>
+
+; interrupt stack: handlers run on MSP
+Stack_Isr_Size  EQU     0x00000200
+
+                AREA    STACK_ISR, NOINIT, READWRITE, ALIGN=3
+Stack_Isr_Mem   SPACE   Stack_Isr_Size
 __initial_sp
+__initial_msp
+
+                EXPORT  Stack_Mem
+                EXPORT  __initial_psp
+                EXPORT  Stack_Isr_Mem
+                EXPORT  __initial_msp
+
+
+; mark of the unused stack space (STACK_PAINT in stack.h)
+Stack_Paint     EQU     0x5354434B
 
 
 ; <h> Heap Configuration
 ;   <o>  Heap Size (in Bytes) <0x0-0xFFFFFFFF:8>
 ; </h>
 
-Heap_Size       EQU     0x00000400
+; heap is not used (no malloc), the space is returned to the stacks and static data
+Heap_Size       EQU     0x00000000
 
                 AREA    HEAP, NOINIT, READWRITE, ALIGN=3
 __heap_base
@@ -170,6 +193,24 @@ Reset_Handler   PROC
                 EXPORT  Reset_Handler                     [WEAK]
                 IMPORT  SystemInit
                 IMPORT  __main
+; fill both stacks with the mark for stackHighWater() (STACK_PAINT in stack.h)
+; nothing is stacked yet, so the whole area is painted and no C frame is overwritten
+                LDR     R2, =Stack_Paint
+                LDR     R0, =Stack_Mem
+                LDR     R1, =__initial_psp
+Paint_Main      STR     R2, [R0], #4
+                CMP     R0, R1
+                BLO     Paint_Main
+                LDR     R0, =Stack_Isr_Mem
+                LDR     R1, =__initial_msp
+Paint_Isr       STR     R2, [R0], #4
+                CMP     R0, R1
+                BLO     Paint_Isr
+                LDR     R0, =__initial_psp
+                MSR     PSP, R0
+                MOVS    R0, #2
+                MSR     CONTROL, R0
+                ISB
                 LDR     R0, =SystemInit
                 BLX     R0
                 LDR     R0, =__main
@@ -38,6 +38,8 @@
 #define RTE_DEVICE_STDPERIPHERALS_SYSCFG
 /* GigaDevice::Device:GD32F1x0_StdPeripherals:TIMER:3.2.0 */
 #define RTE_DEVICE_STDPERIPHERALS_TIMER
+/* GigaDevice::Device:GD32F1x0_StdPeripherals:USART:3.2.0 */
+#define RTE_DEVICE_STDPERIPHERALS_USART
 /* GigaDevice::Device:GD32F1x0_StdPeripherals:WWDGT:3.2.0 */
 #define RTE_DEVICE_STDPERIPHERALS_WWDGT
 
@@ -43,6 +43,13 @@
 	# define PIN_HALL_A														PB11
 	# define PIN_HALL_B														PF1
 	# define PIN_HALL_C														PC14
+	//  
+	//   (USART1):   ,    (,  PIN_AUX_TX)
+	# define PIN_AUX_TX														PA2
+	# define PIN_AUX_RX														PA3
+	//  / (USART0): TX    RX   
+	# define PIN_LINK_TX													PB6
+	# define PIN_LINK_RX													PB7
 
 
 	//   
@@ -59,6 +66,155 @@
 	//   
 	# define CONST_MOTOR_AMP 											0.201465201465
 	# define CONST_BATTERY_VOLT      							0.024169921875
+	//     Q16 (    ),     
+	# define CONST_MOTOR_MA_Q16										FIX_Q16(CONST_MOTOR_AMP * 1000.0)
+	# define CONST_BATTERY_MV_Q16									FIX_Q16(CONST_BATTERY_VOLT * 1000.0)
+	//    (),     
+	# define ADC_VDDA_MV													3300
+	//   
+	# define ADC_FULL_SCALE												4095
+	//     Vrefint ()
+	# define ADC_VREFINT_MV												1200
+	//   :   25C ()   (/C)
+	# define ADC_TEMP_V25_MV											1430
+	# define ADC_TEMP_SLOPE_UV										4300
+
+	// 
+	//   
+	# define BATTERY_CELLS												10
+	//  (*)
+	# define BATTERY_CAPACITY_MAH									7800
+	//         ()
+	# define BATTERY_RINT_MOHM										150
+	# define BATTERY_RINT_MIN_MOHM								20
+	# define BATTERY_RINT_MAX_MOHM								2000
+	//   (RLS):      ()   
+	# define BATTERY_RLS_MIN_STEP_MA							2000
+	# define BATTERY_RLS_LAMBDA										0.98
+	//   BMS ()     ()
+	# define BATTERY_CUTOFF_MV										(BATTERY_CELLS * 3000)
+	# define BATTERY_MAX_MA												20000
+	//          ()
+	# define BATTERY_REST_MA											500
+	//          ()
+	# define BATTERY_REST_MS											5000
+	//  :   1/2^N  
+	# define BATTERY_OCV_SHIFT										5
+	//   batteryTask() ()
+	# define BATTERY_TASK_MS											100
+	//       (0.01%)
+	# define BATTERY_SAVE_DELTA										100
+
+	// 
+	//   PIN_POWER   
+	# define POWER_BUTTON_ACTIVE									SET
+	//      ()    powerTask() ()
+	# define POWER_IDLE_MS												300000
+	# define POWER_TASK_MS												100
+
+	//   (     )
+	//   derateTask() ()
+	# define DERATE_TASK_MS												100
+	//   :   +  ( )   ()
+	# define DERATE_VOLT_SPAN_MV									2000
+	//   (0.01%):  START    FLOOR  MIN
+	# define DERATE_SOC_START											2000
+	# define DERATE_SOC_MIN												300
+	//   (0.1C):  START ( )  MAX ( )
+	# define DERATE_MCU_START											700
+	# define DERATE_MCU_MAX												850
+	//       -   
+	# define DERATE_FLOOR													300
+	//      (  )
+	# define DERATE_STEP_DOWN											50
+	# define DERATE_STEP_UP												10
+
+	//   (I2t)     
+	//     ()     ()
+	# define THERMAL_WINDING_MA										15000
+	# define THERMAL_WINDING_TAU_S								300
+	# define THERMAL_BRIDGE_MA										20000
+	# define THERMAL_BRIDGE_TAU_S									30
+	//    (%),     
+	# define THERMAL_DERATE_START									80
+	//   ()       
+	# define THERMAL_DUTY_MIN											100
+
+	//  ,     (. KickScooter.sct)
+	# define NOINIT_ADDR													0x20001F00
+	# define NOINIT_SIZE													0x100
+
+	//       (   RAMFUNC,  RW_RAMCODE  KickScooter.sct)
+	// 0 -    :     engineCycles().  : 
+	//  72    2  ,      , 
+	//  -  2    ,      
+	# define RAMFUNC_ENABLE												1
+
+	// :       ()
+	# define SUP_PERIOD_MS												20
+	//          ()
+	# define SUP_SLACK_MS													200
+	//    (WWDGT,   ~58 ): 0 -  FWDGT.  
+	//  ( )       
+	# define SUP_WWDGT														0
+	//     ()
+	# define BLDC_SUP_MS													5
+
+	//   :    ( ,  -  ),
+	//     (IROM1 = 0xF800)
+	# define STORAGE_PAGE_ADDR										0x0800F800
+	# define STORAGE_PAGE_SIZE										0x400
+	//   
+	# define STORAGE_ID_BATTERY										1
+
+	//  :       (),  PWM_FREQ
+	# define MR_SPEED_HZ													2000
+	# define MR_SUPER_HZ													100
+	//        ()
+	# define BLDC_SPEED_TIMEOUT_MS								500
+	//   :    ()
+	# define BLDC_HALL_FAULT_MS										100
+	//     ( )
+	# define BLDC_EVENT_COUNT											8
+
+	// 
+	//    (value -   )
+	# define EVENT_HALL_FAULT											1
+
+	//   (SERIAL_AUX):   
+	// AUX_PROTOCOL_FRAME -    (COBS, CRC-16), AUX_PROTOCOL_NINEBOT -   "55 AA"
+	# define AUX_PROTOCOL_FRAME										0
+	# define AUX_PROTOCOL_NINEBOT									1
+	# define AUX_PROTOCOL													AUX_PROTOCOL_FRAME
+	# define AUX_BAUD															115200
+	//  ( SERIAL_AUX):   ()    (TELEMETRY_F_*  telemetry.h)
+	# define TELEMETRY_PERIOD_MS									50
+	# define TELEMETRY_FIELDS											0xFF
+	//  ( SERIAL_AUX):   (),     
+	//   (),         (  )
+	# define COMMAND_TASK_MS											10
+	# define COMMAND_TIMEOUT_MS										200
+	# define COMMAND_RAMP_STEP										20
+	//  / ( SERIAL_LINK):  (1 - , 0 - ), , 
+	//   (),       (),   
+	//     (  )
+	# define LINK_MASTER													1
+	# define LINK_BAUD														460800
+	# define LINK_PERIOD_MS												5
+	# define LINK_TIMEOUT_MS											30
+	# define LINK_RAMP_STEP												20
+	//   "55 AA" (AUX_PROTOCOL_NINEBOT):   (),   
+	//     ()       (  ),  
+	//   (    )    
+	# define NINEBOT_TASK_MS											10
+	# define NINEBOT_TIMEOUT_MS										200
+	# define NINEBOT_RAMP_STEP										20
+	# define NINEBOT_THROTTLE_MIN									0x2C
+	# define NINEBOT_THROTTLE_MAX									0xC2
+	# define NINEBOT_BRAKE_ON											0x30
+	// :       (),    
+	# define WHEEL_POLE_PAIRS											15
+	# define WHEEL_LENGTH_MM											690
 
 	# define PWM_FREQ															16000
 	# define TIMEOUT_FREQ													1000
@@ -70,8 +226,8 @@
 	# define ARM_MATH_CM3
 
 	// Useful math function defines
-	# define ABS(a) (((a) < 0.0) ? -(a) : (a))
+	# define ABS(a) (((a) < 0) ? -(a) : (a))
 	# define CLAMP(x, low, high) (((x) > (high)) ? (high) : (((x) < (low)) ? (low) : (x)))
 	# define MAX(x, high) (((x) > (high)) ? (high) : (x))
-	# define MAP(x, xMin, xMax, yMin, yMax) ((x - xMin) * (yMax - yMin) / (xMax - xMin) + yMin)
+	# define MAP(x, xMin, xMax, yMin, yMax) (((x) - (xMin)) * ((yMax) - (yMin)) / ((xMax) - (xMin)) + (yMin))
 #endif
@@ -0,0 +1,145 @@
+// #INDEX# ======================================================================================================
+// Title .........:   (HardFault)   
+// Arch ..........: GD32F130C8C6
+// Author ........: GreenBytes ( https://vk.com/greenbytes )
+// Version .......: 1.0.0.0
+// ==============================================================================================================
+
+//  
+//      
+#include "gd32f1x0.h"
+//   
+#include "fault.h"
+//  
+#include "framework.h"
+//    
+#include "../define.h"
+
+//   
+# define FAULT_MAGIC										0x48464C54
+//           
+# define FAULT_SCAN_WORDS								64
+//       
+# define FAULT_FLASH_START							0x08000000U
+# define FAULT_FLASH_END								0x08010000U
+# define FAULT_RAM_START								0x20000000U
+# define FAULT_RAM_END									NOINIT_ADDR
+
+// :  (  )    
+NOINIT faultDump fault_dump;
+faultDump fault_lastDump;
+FlagStatus fault_hasDump = RESET;
+//   
+uint8_t fault_cause = 0;
+
+// #FAULT# ----------------------------------------------------
+// Description....:    (    check)
+// Argument.......:
+//      const faultDump *DUMP				= 
+// ------------------------------------------------------------
+static uint32_t faultCheck(const faultDump *DUMP) {
+	const uint32_t *word = (const uint32_t *)DUMP;
+	uint32_t sum = 0x5A5A5A5A;
+	uint8_t i;
+	for (i = 0; i < (sizeof(faultDump) / 4) - 1; i++) sum = ((sum << 5) | (sum >> 27)) ^ word[i];
+	return sum;
+}
+
+// #FAULT# ----------------------------------------------------
+// Description....:         ,   RCU.
+//									    
+// Argument.......: 
+// ------------------------------------------------------------
+void faultInit(void) {
+	if (rcu_flag_get(RCU_FLAG_PORRST) == SET) fault_cause |= FAULT_RESET_POWER;
+	if (rcu_flag_get(RCU_FLAG_EPRST) == SET) fault_cause |= FAULT_RESET_PIN;
+	if (rcu_flag_get(RCU_FLAG_SWRST) == SET) fault_cause |= FAULT_RESET_SOFTWARE;
+	if (rcu_flag_get(RCU_FLAG_FWDGTRST) == SET) fault_cause |= FAULT_RESET_FWDGT;
+	if (rcu_flag_get(RCU_FLAG_WWDGTRST) == SET) fault_cause |= FAULT_RESET_WWDGT;
+	if (rcu_flag_get(RCU_FLAG_LPRST) == SET) fault_cause |= FAULT_RESET_LOWPOWER;
+	if (rcu_flag_get(RCU_FLAG_OBLRST) == SET) fault_cause |= FAULT_RESET_OPTION;
+	rcu_all_reset_flag_clear();
+	//       -   
+	if (!(fault_cause & FAULT_RESET_POWER) && fault_dump.magic == FAULT_MAGIC && fault_dump.check == faultCheck(&fault_dump)) {
+		fault_lastDump = fault_dump;
+		fault_hasDump = SET;
+		fault_cause |= FAULT_RESET_HARDFAULT;
+	}
+	fault_dump.magic = 0;
+}
+
+// #FAULT# ----------------------------------------------------
+// Description....:    ( FAULT_RESET_*)
+// Argument.......: 
+// ------------------------------------------------------------
+uint8_t faultResetCause(void) {
+	return fault_cause;
+}
+
+// #FAULT# ----------------------------------------------------
+// Description....:  ,    (NULL -   )
+// Argument.......: 
+// ------------------------------------------------------------
+const faultDump *faultLastDump(void) {
+	return (fault_hasDump == SET) ? &fault_lastDump : NULL;
+}
+
+// #FAULT# ----------------------------------------------------
+// Description....:    .   HardFault_Handler
+// Argument.......:
+//      uint32_t *FRAME							=     (R0-R3, R12, LR, PC, xPSR)
+//      uint32_t EXC_RETURN					=  LR    
+// ------------------------------------------------------------
+void faultCapture(uint32_t *FRAME, uint32_t EXC_RETURN) {
+	uint32_t *word;
+	uint8_t depth = 0;
+	uint8_t i;
+	//        :    
+	//   (lockup)  ,    sp, CFSR  EXC_RETURN
+	if ((uint32_t)FRAME >= FAULT_RAM_START && (uint32_t)(FRAME + 8) <= FAULT_RAM_END) {
+		fault_dump.r0 = FRAME[0];
+		fault_dump.r1 = FRAME[1];
+		fault_dump.r2 = FRAME[2];
+		fault_dump.r3 = FRAME[3];
+		fault_dump.r12 = FRAME[4];
+		fault_dump.lr = FRAME[5];
+		fault_dump.pc = FRAME[6];
+		fault_dump.xpsr = FRAME[7];
+	} else {
+		fault_dump.r0 = fault_dump.r1 = fault_dump.r2 = fault_dump.r3 = 0;
+		fault_dump.r12 = fault_dump.lr = fault_dump.pc = fault_dump.xpsr = 0;
+	}
+	fault_dump.cfsr = SCB->CFSR;
+	fault_dump.hfsr = SCB->HFSR;
+	fault_dump.bfar = SCB->BFAR;
+	fault_dump.mmfar = SCB->MMFAR;
+	fault_dump.sp = (uint32_t)FRAME;
+	fault_dump.excReturn = EXC_RETURN;
+	fault_dump.time = millis();
+	// :    ,     (Thumb-  )
+	word = FRAME + 8;
+	for (i = 0; i < FAULT_SCAN_WORDS && depth < FAULT_TRACE_DEPTH; i++, word++) {
+		if ((uint32_t)word < FAULT_RAM_START || (uint32_t)word >= FAULT_RAM_END) break;
+		if ((*word & 1) && *word >= FAULT_FLASH_START && *word < FAULT_FLASH_END) fault_dump.trace[depth++] = *word;
+	}
+	while (depth < FAULT_TRACE_DEPTH) fault_dump.trace[depth++] = 0;
+	fault_dump.magic = FAULT_MAGIC;
+	fault_dump.check = faultCheck(&fault_dump);
+	NVIC_SystemReset();
+}
+
+// #FAULT# ----------------------------------------------------
+// Description....:   :  ,    ,    faultCapture
+// Argument.......: 
+// ------------------------------------------------------------
+#if defined(__CC_ARM)
+__asm void HardFault_Handler(void) {
+	IMPORT faultCapture
+	TST			LR, #4
+	ITE			EQ
+	MRSEQ		R0, MSP
+	MRSNE		R0, PSP
+	MOV			R1, LR
+	B				faultCapture
+}
+#endif
@@ -0,0 +1,71 @@
+// #INDEX# ======================================================================================================
+// Title .........:   (HardFault)   
+// Arch ..........: GD32F130C8C6
+// Author ........: GreenBytes ( https://vk.com/greenbytes )
+// Version .......: 1.0.0.0
+// ==============================================================================================================
+
+#ifndef FAULT_H
+
+	#define FAULT_H
+
+	#include "gd32f1x0.h"
+	#include "../define.h"
+
+	// 
+	//  :  ,      
+	# define FAULT_TRACE_DEPTH						6
+	//   ( ,   )
+	# define FAULT_RESET_POWER						BIT(0)
+	# define FAULT_RESET_PIN							BIT(1)
+	# define FAULT_RESET_SOFTWARE					BIT(2)
+	# define FAULT_RESET_FWDGT						BIT(3)
+	# define FAULT_RESET_WWDGT						BIT(4)
+	# define FAULT_RESET_LOWPOWER					BIT(5)
+	# define FAULT_RESET_OPTION						BIT(6)
+	# define FAULT_RESET_HARDFAULT				BIT(7)
+
+	//   (    )
+	typedef struct {
+		uint32_t magic;
+		// ,         (,     -  )
+		uint32_t r0, r1, r2, r3, r12, lr, pc, xpsr;
+		//    SCB
+		uint32_t cfsr, hfsr, bfar, mmfar;
+		//       EXC_RETURN (    )
+		uint32_t sp, excReturn;
+		//   (  )
+		uint32_t time;
+		//   (0 - )
+		uint32_t trace[FAULT_TRACE_DEPTH];
+		uint32_t check;
+	} faultDump;
+
+	// #FAULT# ----------------------------------------------------
+	// Description....:         ,   RCU.
+	//									    
+	// Argument.......: 
+	// ------------------------------------------------------------
+	void faultInit(void);
+
+	// #FAULT# ----------------------------------------------------
+	// Description....:    ( FAULT_RESET_*)
+	// Argument.......: 
+	// ------------------------------------------------------------
+	uint8_t faultResetCause(void);
+
+	// #FAULT# ----------------------------------------------------
+	// Description....:  ,    (NULL -   )
+	// Argument.......: 
+	// ------------------------------------------------------------
+	const faultDump *faultLastDump(void);
+
+	// #FAULT# ----------------------------------------------------
+	// Description....:       (0 -  )
+	// Argument.......:
+	//      const faultDump *DUMP				= 
+	// ------------------------------------------------------------
+	static __INLINE uint16_t faultIsr(const faultDump *DUMP) {
+		return (uint16_t)(DUMP->xpsr & 0x1FF);
+	}
+#endif
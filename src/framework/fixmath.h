@@ -0,0 +1,116 @@
+// #INDEX# ======================================================================================================
+// Title .........:     (Q-)    soft-float
+// Arch ..........: GD32F130C8C6
+// Author ........: GreenBytes ( https://vk.com/greenbytes )
+// Version .......: 1.0.0.0
+// ==============================================================================================================
+
+#ifndef FIXMATH_H
+
+	#define FIXMATH_H
+
+	#include "gd32f1x0.h"
+
+	// 
+	// Q16.16: 16       16  
+	typedef int32_t q16_t;
+	// Q1.15:  [-1; 1)
+	typedef int16_t q15_t;
+
+	// 
+	//   Q16
+	# define FIX_Q16_ONE													((q16_t)0x00010000)
+	//   Q15 ()
+	# define FIX_Q15_ONE													((q15_t)0x7FFF)
+
+	//      ( "  "  )
+	# define FIX_STATIC_ASSERT(cond, name)				typedef char fix_assert_##name[(cond) ? 1 : -1]
+
+	//     Q-.  ,  
+	//    .     !
+	# define FIX_Q16(x)														((q16_t)((x) * 65536.0 + (((x) < 0) ? -0.5 : 0.5)))
+	# define FIX_Q15(x)														((q15_t)((x) * 32768.0 + (((x) < 0) ? -0.5 : 0.5)))
+	//    x * SCALE   Q16 / x   Q15 ( FIX_STATIC_ASSERT)
+	//     C90      
+	//  ,  x -    ,   
+	//  :        1 / SCALE
+	# define FIX_Q16_FITS(x, SCALE)								((int32_t)(x) < 0x8000L / (SCALE) && (int32_t)(x) > -0x8000L / (SCALE))
+	# define FIX_Q15_FITS(x)											((int32_t)(x) == 0)
+
+	//    fixMap(): (yMax - yMin) / (xMax - xMin)  Q16,   
+	# define FIX_MAP_K(xMin, xMax, yMin, yMax)		FIX_Q16((double)((yMax) - (yMin)) / (double)((xMax) - (xMin)))
+
+	// #FIXMATH# --------------------------------------------------
+	// Description....:  64-    int32_t
+	// Argument.......:
+	//      int64_t x										=  
+	// ------------------------------------------------------------
+	static __INLINE int32_t fixSat32(int64_t x) {
+		if (x > 0x7FFFFFFFLL) return 0x7FFFFFFF;
+		if (x < -0x80000000LL) return (int32_t)0x80000000;
+		return (int32_t)x;
+	}
+
+	// #FIXMATH# --------------------------------------------------
+	// Description....:  Q16 x Q16 -> Q16 (  SMULL  )
+	// Argument.......:
+	//      q16_t a, q16_t b						= 
+	// ------------------------------------------------------------
+	static __INLINE q16_t fixMul(q16_t a, q16_t b) {
+		return (q16_t)(((int64_t)a * b) >> 16);
+	}
+
+	// #FIXMATH# --------------------------------------------------
+	// Description....:  Q16 x Q16 -> Q16  
+	// Argument.......:
+	//      q16_t a, q16_t b						= 
+	// ------------------------------------------------------------
+	static __INLINE q16_t fixMulSat(q16_t a, q16_t b) {
+		return fixSat32(((int64_t)a * b) >> 16);
+	}
+
+	// #FIXMATH# --------------------------------------------------
+	// Description....:  Q15 x Q15 -> Q15   (-1 * -1 = 0x7FFF)
+	// Argument.......:
+	//      q15_t a, q15_t b						= 
+	// ------------------------------------------------------------
+	static __INLINE q15_t fixMul15(q15_t a, q15_t b) {
+		return (q15_t)__SSAT(((int32_t)a * b) >> 15, 16);
+	}
+
+	// #FIXMATH# --------------------------------------------------
+	// Description....:    (  )  Q16
+	// Argument.......:
+	//      uint32_t raw								=  
+	//      q16_t k											=  (>= 0)
+	// ------------------------------------------------------------
+	static __INLINE uint32_t fixScale(uint32_t raw, q16_t k) {
+		return (uint32_t)(((uint64_t)raw * (uint32_t)k) >> 16);
+	}
+
+	// #FIXMATH# --------------------------------------------------
+	// Description....:   MAP()    FIX_MAP_K() -  
+	// Argument.......:
+	//      int32_t x										=  
+	//      int32_t xMin								=   
+	//      int32_t yMin								=   
+	//      q16_t k											=  FIX_MAP_K(xMin, xMax, yMin, yMax)
+	// ------------------------------------------------------------
+	static __INLINE int32_t fixMap(int32_t x, int32_t xMin, int32_t yMin, q16_t k) {
+		return yMin + fixMulSat(x - xMin, k);
+	}
+
+	// #FIXMATH# --------------------------------------------------
+	// Description....: fixMap()     
+	// Argument.......:
+	//      int32_t x										=  
+	//      int32_t xMin, int32_t xMax	=  
+	//      int32_t yMin, int32_t yMax	=  
+	//      q16_t k											=  FIX_MAP_K(xMin, xMax, yMin, yMax)
+	// ------------------------------------------------------------
+	static __INLINE int32_t fixMapClamp(int32_t x, int32_t xMin, int32_t xMax, int32_t yMin, int32_t yMax, q16_t k) {
+		if (x <= xMin) return yMin;
+		if (x >= xMax) return yMax;
+		return fixMap(x, xMin, yMin, k);
+	}
+#endif
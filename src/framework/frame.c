@@ -0,0 +1,106 @@
+// #INDEX# ======================================================================================================
+// Title .........:   : COBS  CRC-16
+// Arch ..........: GD32F130C8C6
+// Author ........: GreenBytes ( https://vk.com/greenbytes )
+// Version .......: 1.0.0.0
+// ==============================================================================================================
+
+//  
+//      
+#include "gd32f1x0.h"
+//  
+#include "frame.h"
+//    
+#include "../define.h"
+
+//  CRC-16/CCITT  
+static const uint16_t frame_crcTable[16] = {
+	0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50A5, 0x60C6, 0x70E7,
+	0x8108, 0x9129, 0xA14A, 0xB16B, 0xC18C, 0xD1AD, 0xE1CE, 0xF1EF
+};
+
+// #FRAME# ----------------------------------------------------
+// Description....: CRC-16/CCITT-FALSE ( 0x1021),    - 32  
+// Argument.......:
+//      const uint8_t *DATA					= 
+//      uint16_t LEN								= 
+//      uint16_t CRC								=   (FRAME_CRC_INIT  CRC  )
+// ------------------------------------------------------------
+uint16_t frameCrc16(const uint8_t *DATA, uint16_t LEN, uint16_t CRC) {
+	while (LEN--) {
+		CRC = (uint16_t)((CRC << 4) ^ frame_crcTable[(CRC >> 12) ^ (*DATA >> 4)]);
+		CRC = (uint16_t)((CRC << 4) ^ frame_crcTable[(CRC >> 12) ^ (*DATA & 0x0F)]);
+		DATA++;
+	}
+	return CRC;
+}
+
+// #FRAME# ----------------------------------------------------
+// Description....:  : CRC   RAW[LEN], RAW[LEN + 1] (  ),
+//									  COBS  DST    .   DST
+// Argument.......:
+//      uint8_t *RAW								=  (   2   CRC)
+//      uint16_t LEN								=  
+//      uint8_t *DST								=   (  FRAME_COBS_SIZE(LEN + 2))
+// ------------------------------------------------------------
+uint16_t frameEncode(uint8_t *RAW, uint16_t LEN, uint8_t *DST) {
+	uint16_t crc = frameCrc16(RAW, LEN, FRAME_CRC_INIT);
+	uint16_t code = 0, out = 1, i;
+	RAW[LEN++] = (uint8_t)crc;
+	RAW[LEN++] = (uint8_t)(crc >> 8);
+	// COBS:        
+	for (i = 0; i < LEN; i++) {
+		if (RAW[i] != FRAME_DELIMITER) DST[out++] = RAW[i];
+		if (RAW[i] == FRAME_DELIMITER || out - code == 0xFF) {
+			DST[code] = (uint8_t)(out - code);
+			code = out++;
+		}
+	}
+	DST[code] = (uint8_t)(out - code);
+	DST[out++] = FRAME_DELIMITER;
+	return out;
+}
+
+// #FRAME# ----------------------------------------------------
+// Description....:    .     
+//									( CRC,   DEC->buf), -1 -      
+// Argument.......:
+//      frameDecoder *DEC						= 
+//      uint8_t BYTE								=  
+// ------------------------------------------------------------
+int16_t frameDecode(frameDecoder *DEC, uint8_t BYTE) {
+	int16_t result = -1;
+	uint8_t len;
+	if (BYTE == FRAME_DELIMITER) {
+		len = DEC->len;
+		//   (  )   
+		if (len > 0 || DEC->start == RESET) {
+			if (DEC->left != 0 || DEC->overflow == SET || len < 2 ||
+				frameCrc16(DEC->buf, (uint16_t)(len - 2), FRAME_CRC_INIT) != (uint16_t)(DEC->buf[len - 2] | (DEC->buf[len - 1] << 8))) {
+				DEC->errors++;
+			} else {
+				result = (int16_t)(len - 2);
+			}
+		}
+		DEC->len = 0;
+		DEC->left = 0;
+		DEC->start = SET;
+		DEC->overflow = RESET;
+		return result;
+	}
+	if (DEC->left == 0) {
+		//   : ,   ,  (  0xFF)
+		if (DEC->start == RESET && DEC->code != 0xFF) {
+			if (DEC->len < DEC->size) DEC->buf[DEC->len++] = 0;
+			else DEC->overflow = SET;
+		}
+		DEC->code = BYTE;
+		DEC->left = (uint8_t)(BYTE - 1);
+		DEC->start = RESET;
+		return -1;
+	}
+	if (DEC->len < DEC->size) DEC->buf[DEC->len++] = BYTE;
+	else DEC->overflow = SET;
+	DEC->left--;
+	return -1;
+}
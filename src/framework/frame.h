@@ -0,0 +1,69 @@
+// #INDEX# ======================================================================================================
+// Title .........:   : COBS  CRC-16
+// Arch ..........: GD32F130C8C6
+// Author ........: GreenBytes ( https://vk.com/greenbytes )
+// Version .......: 1.0.0.0
+// ==============================================================================================================
+
+#ifndef FRAME_H
+
+	#define FRAME_H
+
+	#include "gd32f1x0.h"
+	#include "../define.h"
+
+	// 
+	//   COBS (    )
+	# define FRAME_DELIMITER							0x00
+	//   CRC-16/CCITT-FALSE
+	# define FRAME_CRC_INIT								0xFFFF
+	//    COBS    LEN   ( CRC)
+	# define FRAME_COBS_SIZE(LEN)					((LEN) + (LEN) / 254 + 2)
+
+	// #FRAME# ----------------------------------------------------
+	// Description....: CRC-16/CCITT-FALSE ( 0x1021),    - 32  
+	// Argument.......:
+	//      const uint8_t *DATA					= 
+	//      uint16_t LEN								= 
+	//      uint16_t CRC								=   (FRAME_CRC_INIT  CRC  )
+	// ------------------------------------------------------------
+	uint16_t frameCrc16(const uint8_t *DATA, uint16_t LEN, uint16_t CRC);
+
+	// #FRAME# ----------------------------------------------------
+	// Description....:  : CRC   RAW[LEN], RAW[LEN + 1] (  ),
+	//									  COBS  DST    .   DST
+	// Argument.......:
+	//      uint8_t *RAW								=  (   2   CRC)
+	//      uint16_t LEN								=  
+	//      uint8_t *DST								=   (  FRAME_COBS_SIZE(LEN + 2))
+	// ------------------------------------------------------------
+	uint16_t frameEncode(uint8_t *RAW, uint16_t LEN, uint8_t *DST);
+
+	//   COBS:        DMA,  BUF 
+	//    
+	typedef struct {
+		uint8_t *buf;
+		uint8_t size;
+		uint8_t len;
+		//      COBS   
+		uint8_t left;
+		uint8_t code;
+		//   /  BUF
+		FlagStatus start;
+		FlagStatus overflow;
+		//   ( COBS, CRC  )
+		uint16_t errors;
+	} frameDecoder;
+
+	//      SIZE  (   CRC,   255)
+	# define FRAME_DECODER(NAME, SIZE)		uint8_t NAME##_buf[SIZE]; frameDecoder NAME = { NAME##_buf, (SIZE), 0, 0, 0, SET, RESET, 0 }
+
+	// #FRAME# ----------------------------------------------------
+	// Description....:    .     
+	//									( CRC,   DEC->buf), -1 -      
+	// Argument.......:
+	//      frameDecoder *DEC						= 
+	//      uint8_t BYTE								=  
+	// ------------------------------------------------------------
+	int16_t frameDecode(frameDecoder *DEC, uint8_t BYTE);
+#endif
@@ -10,6 +10,10 @@
 #include "gd32f1x0.h"
 //  
 #include "framework.h"
+#include "scheduler.h"
+#include "multirate.h"
+#include "supervisor.h"
+#include "fault.h"
 //    
 #include "../define.h"
 
@@ -19,67 +23,69 @@ timer_parameter_struct timerBldc_paramter_struct;
 timer_break_parameter_struct timerBldc_break_parameter_struct;
 timer_oc_parameter_struct timerBldc_oc_parameter_struct;
 
-//    
-uint32_t msTicks = 0;
+//     ( SysTick   TIMEOUT_FREQ)
+volatile uint32_t msTicks = 0;
+//    
+volatile uint32_t fw_msHigh = 0;
+//    ()     DWT   
+volatile uint64_t fw_usBase = 0;
+volatile uint32_t fw_cycAtTick = 0;
+//     SysTick   
+uint32_t fw_cycPerTick = 72000000 / TIMEOUT_FREQ;
+uint32_t fw_cycPerUs = 72;
+//    (     fw_init)
+uint32_t fw_bootStamp[BOOT_PHASES];
+//  
+bootFunc fw_bootDeferred[BOOT_DEFER_MAX];
+uint8_t fw_bootDeferCount = 0;
+// ,     ( ):   -  BOOT_DEFER_MAX
+uint8_t fw_bootDeferOverflow = 0;
 //    
 uint16_t fw_adc;
+//   Vrefint ()
+uint16_t fw_vrefint = 0;
+//   :  VDDA / ADC_VDDA_MV
+q16_t fw_adcGain = FIX_Q16_ONE;
+//    (0.1C)
+int16_t fw_mcuTemp = 250;
+//  : Vrefint *  / ADC_VDDA_MV  Q16,   
+# define ADC_GAIN_NUM										((uint32_t)((((uint64_t)ADC_VREFINT_MV * ADC_FULL_SCALE) << 16) / ADC_VDDA_MV))
 
-// #FRAMEWORK# ------------------------------------------------
-// Description....:     
-// Argument.......: 
-//      uint8_t PIN									=    
-// ------------------------------------------------------------
-uint32_t getPort(uint8_t PIN) {
-	if (PIN >= PA0 && PIN <= PA15) return GPIOA;
-	if (PIN >= PB0 && PIN <= PB15) return GPIOB;
-	if (PIN >= PC0 && PIN <= PC15) return GPIOC;
-	if (PIN >= PD0 && PIN <= PD15) return GPIOD;
-	if (PIN >= PF0 && PIN <= PF15) return GPIOF;
-	return 0;
-}
+//      Q16  32- 
+FIX_STATIC_ASSERT(FIX_Q16_FITS(CONST_MOTOR_AMP, 1000), motor_ma_q16);
+FIX_STATIC_ASSERT(FIX_Q16_FITS(CONST_BATTERY_VOLT, 1000), battery_mv_q16);
+FIX_STATIC_ASSERT(ADC_GAIN_NUM / ADC_FULL_SCALE < 0x7FFFFFFF / ADC_FULL_SCALE, adc_gain_range);
+//          
+FIX_STATIC_ASSERT(getPort(PA15) == GPIOA && getPort(PB0) == GPIOB && getPort(PC15) == GPIOC, pin_port_abc);
+FIX_STATIC_ASSERT(getPort(PD0) == GPIOD && getPort(PF0) == GPIOF && getPort(PF15) == GPIOF, pin_port_df);
+FIX_STATIC_ASSERT(getChannel(PA7) == ADC_CHANNEL_7 && getChannel(PB1) == ADC_CHANNEL_9, pin_channel);
 
-// #FRAMEWORK# ------------------------------------------------
-// Description....:     
-// Argument.......: 
-//      uint8_t PIN									=    
-// ------------------------------------------------------------
-uint32_t getPin(uint8_t PIN) {
-	if (PIN >= PB0 && PIN <= PB15) PIN = PIN - PB0;
-	if (PIN >= PC0 && PIN <= PC15) PIN = PIN - PC0;
-	if (PIN >= PD0 && PIN <= PD15) PIN = PIN - PD0;
-	if (PIN >= PF0 && PIN <= PF15) PIN = PIN - PF0;
-	return BIT(PIN);
-}
+//  :  ,       (TIMER0, AF2)
+const pinConfig fw_pins[] = {
+	PIN_CONFIG(PIN_HALL_A, GPIO_MODE_INPUT, GPIO_PUPD_NONE, GPIO_OTYPE_PP, GPIO_OSPEED_2MHZ, GPIO_AF_0),
+	PIN_CONFIG(PIN_HALL_B, GPIO_MODE_INPUT, GPIO_PUPD_NONE, GPIO_OTYPE_PP, GPIO_OSPEED_2MHZ, GPIO_AF_0),
+	PIN_CONFIG(PIN_HALL_C, GPIO_MODE_INPUT, GPIO_PUPD_NONE, GPIO_OTYPE_PP, GPIO_OSPEED_2MHZ, GPIO_AF_0),
+	PIN_CONFIG(PIN_BLDC_EMERGENCY_SHUTDOWN, GPIO_MODE_AF, GPIO_PUPD_NONE, GPIO_OTYPE_PP, GPIO_OSPEED_2MHZ, GPIO_AF_2),
+	PIN_CONFIG(PIN_BLDC_GH, GPIO_MODE_AF, GPIO_PUPD_NONE, GPIO_OTYPE_PP, GPIO_OSPEED_2MHZ, GPIO_AF_2),
+	PIN_CONFIG(PIN_BLDC_BH, GPIO_MODE_AF, GPIO_PUPD_NONE, GPIO_OTYPE_PP, GPIO_OSPEED_2MHZ, GPIO_AF_2),
+	PIN_CONFIG(PIN_BLDC_YH, GPIO_MODE_AF, GPIO_PUPD_NONE, GPIO_OTYPE_PP, GPIO_OSPEED_2MHZ, GPIO_AF_2),
+	PIN_CONFIG(PIN_BLDC_GL, GPIO_MODE_AF, GPIO_PUPD_NONE, GPIO_OTYPE_PP, GPIO_OSPEED_2MHZ, GPIO_AF_2),
+	PIN_CONFIG(PIN_BLDC_BL, GPIO_MODE_AF, GPIO_PUPD_NONE, GPIO_OTYPE_PP, GPIO_OSPEED_2MHZ, GPIO_AF_2),
+	PIN_CONFIG(PIN_BLDC_YL, GPIO_MODE_AF, GPIO_PUPD_NONE, GPIO_OTYPE_PP, GPIO_OSPEED_2MHZ, GPIO_AF_2)
+};
 
 // #FRAMEWORK# ------------------------------------------------
-// Description....:     
-// Argument.......: 
-//      uint8_t PIN									=    
+// Description....:    
+// Argument.......:
+//      uint8_t CHANNEL							=  
+//      uint32_t SAMPLETIME					=  
 // ------------------------------------------------------------
-uint8_t getChannel(uint8_t PIN) {
-	switch (PIN) {
-		case PA0:
-			return ADC_CHANNEL_0;
-		case PA1:
-			return ADC_CHANNEL_1;
-		case PA2:
-			return ADC_CHANNEL_2;
-		case PA3:
-			return ADC_CHANNEL_3;
-		case PA4:
-			return ADC_CHANNEL_4;
-		case PA5:
-			return ADC_CHANNEL_5;
-		case PA6:
-			return ADC_CHANNEL_6;
-		case PA7:
-			return ADC_CHANNEL_7;
-		case PB0:
-			return ADC_CHANNEL_8;
-		case PB1:
-			return ADC_CHANNEL_9;
-	}
-	return 0;
+static uint16_t adcConvert(uint8_t CHANNEL, uint32_t SAMPLETIME) {
+	adc_regular_channel_config(0U, CHANNEL, SAMPLETIME);
+	adc_software_trigger_enable(ADC_REGULAR_CHANNEL);
+	while(!adc_flag_get(ADC_FLAG_EOC));
+	adc_flag_clear(ADC_FLAG_EOC);
+	return (adc_regular_data_read() & 0xfff);
 }
 
 // #FRAMEWORK# ------------------------------------------------
@@ -102,24 +108,88 @@ void pinMode(uint8_t PIN, uint32_t TYPE, uint32_t MODE) {
 }
 
 // #FRAMEWORK# ------------------------------------------------
-// Description....:    
+// Description....:   :       ,
+//									       ( N -  PIN_STEP(PIN, N))
 // Argument.......: 
-//      uint8_t PIN									=    
-//			FlagStatus fSTATUS					=   (. . framefork.h)
-//					LOW											=  
-//					HIGH										=  
+//      const pinGroup *GROUP				=  
 // ------------------------------------------------------------
-void digitalWrite(uint8_t PIN, FlagStatus fSTATUS) {
-	gpio_bit_write(getPort(PIN), getPin(PIN), fSTATUS);
+RAMFUNC uint32_t pinGroupRead(const pinGroup *GROUP) {
+	uint32_t snap[PIN_GROUP_PORTS];
+	uint32_t result = 0;
+	uint32_t value;
+	const pinStep *step;
+	uint8_t i;
+	for (i = 0; i < PIN_GROUP_PORTS; i++) {
+		if (GROUP->ports & BIT(i)) snap[i] = GPIO_ISTAT(getPort(i << 4));
+	}
+	for (i = 0; i < GROUP->count; i++) {
+		step = &GROUP->step[i];
+		value = snap[step->port] & step->mask;
+		result |= (step->shift >= 0) ? value >> step->shift : value << -step->shift;
+	}
+	return result;
 }
 
 // #FRAMEWORK# ------------------------------------------------
-// Description....:    
+// Description....:   :    GPIO_BOP   (  
+//									 )
 // Argument.......: 
-//      uint8_t PIN									=    
+//      const pinGroup *GROUP				=  
+//      uint32_t VALUE							=   ( N -  PIN_STEP(PIN, N))
+// ------------------------------------------------------------
+void pinGroupWrite(const pinGroup *GROUP, uint32_t VALUE) {
+	uint32_t bop[PIN_GROUP_PORTS] = { 0 };
+	uint32_t value;
+	const pinStep *step;
+	uint8_t i;
+	for (i = 0; i < GROUP->count; i++) {
+		step = &GROUP->step[i];
+		value = ((step->shift >= 0) ? VALUE << step->shift : VALUE >> -step->shift) & step->mask;
+		bop[step->port] |= value | ((step->mask & ~value) << 16);
+	}
+	for (i = 0; i < PIN_GROUP_PORTS; i++) {
+		if (GROUP->ports & BIT(i)) GPIO_BOP(getPort(i << 4)) = bop[i];
+	}
+}
+
+// #FRAMEWORK# ------------------------------------------------
+// Description....:    :       ,
+//									      ( - ,   AF)
+// Argument.......: 
+//      const pinConfig *TABLE			=  
+//      uint8_t COUNT								=  
 // ------------------------------------------------------------
-FlagStatus digitalRead(uint8_t PIN) {
-	return gpio_input_bit_get(getPort(PIN), getPin(PIN));
+void pinConfigApply(const pinConfig *TABLE, uint8_t COUNT) {
+	uint32_t mask2, ctl, pud, ospd, mask1, omode, afMask[2], afVal[2];
+	uint32_t port, pos;
+	const pinConfig *cfg;
+	uint8_t p, i;
+	for (p = 0; p < PIN_GROUP_PORTS; p++) {
+		mask2 = ctl = pud = ospd = mask1 = omode = 0;
+		afMask[0] = afMask[1] = afVal[0] = afVal[1] = 0;
+		for (i = 0; i < COUNT; i++) {
+			cfg = &TABLE[i];
+			if ((cfg->pin >> 4) != p) continue;
+			pos = cfg->pin & 0x0F;
+			//   CTL, PUD, OSPD,  OMODE,  AFSEL0 / AFSEL1
+			mask2 |= 0x3U << (pos * 2);
+			ctl |= (uint32_t)cfg->mode << (pos * 2);
+			pud |= (uint32_t)cfg->pupd << (pos * 2);
+			ospd |= (uint32_t)cfg->ospeed << (pos * 2);
+			mask1 |= BIT(pos);
+			omode |= (uint32_t)cfg->otype << pos;
+			afMask[pos >> 3] |= 0xFU << ((pos & 0x07) * 4);
+			afVal[pos >> 3] |= (uint32_t)cfg->af << ((pos & 0x07) * 4);
+		}
+		if (mask1 == 0) continue;
+		port = getPort(p << 4);
+		GPIO_PUD(port) = (GPIO_PUD(port) & ~mask2) | pud;
+		GPIO_OSPD(port) = (GPIO_OSPD(port) & ~mask2) | ospd;
+		GPIO_OMODE(port) = (GPIO_OMODE(port) & ~mask1) | omode;
+		if (afMask[0]) GPIO_AFSEL0(port) = (GPIO_AFSEL0(port) & ~afMask[0]) | afVal[0];
+		if (afMask[1]) GPIO_AFSEL1(port) = (GPIO_AFSEL1(port) & ~afMask[1]) | afVal[1];
+		GPIO_CTL(port) = (GPIO_CTL(port) & ~mask2) | ctl;
+	}
 }
 
 // #FRAMEWORK# ------------------------------------------------
@@ -128,20 +198,102 @@ FlagStatus digitalRead(uint8_t PIN) {
 //      uint8_t PIN									=    
 // ------------------------------------------------------------
 uint16_t analogRead(uint8_t PIN) {
-    adc_regular_channel_config(0U, getChannel(PIN), ADC_SAMPLETIME_13POINT5);
-    while(!adc_flag_get(ADC_FLAG_EOC));
-    adc_flag_clear(ADC_FLAG_EOC);
-    return (adc_regular_data_read() & 0xfff);    
+	return adcConvert(getChannel(PIN), ADC_SAMPLETIME_13POINT5);
+}
+
+// #FRAMEWORK# ------------------------------------------------
+// Description....:         VDDA
+//									   ADC_VDDA_MV,  CONST_*   
+// Argument.......: 
+//      uint8_t PIN									=    
+// ------------------------------------------------------------
+uint16_t analogReadComp(uint8_t PIN) {
+	return (uint16_t)fixScale(analogRead(PIN), fw_adcGain);
+}
+
+// #FRAMEWORK# ------------------------------------------------
+// Description....:       
+//									  Vrefint  ,  
+// Argument.......: 
+//      uint8_t PIN									=    
+//			q16_t K											=      Q16 ( CONST_BATTERY_MV_Q16)
+// ------------------------------------------------------------
+uint32_t analogReadScaled(uint8_t PIN, q16_t K) {
+	return fixScale(analogRead(PIN), fixMul(K, fw_adcGain));
+}
+
+// #FRAMEWORK# ------------------------------------------------
+// Description....:     Vrefint   
+//									  (   ),   - 
+// Argument.......: 
+// ------------------------------------------------------------
+void adcCompensate(void) {
+	uint32_t vdda;
+	uint32_t temp;
+	fw_vrefint = adcConvert(ADC_CHANNEL_17, ADC_SAMPLETIME_239POINT5);
+	temp = adcConvert(ADC_CHANNEL_16, ADC_SAMPLETIME_239POINT5);
+	if (fw_vrefint == 0) return;
+	fw_adcGain = (q16_t)(ADC_GAIN_NUM / fw_vrefint);
+	vdda = (uint32_t)ADC_VREFINT_MV * ADC_FULL_SCALE / fw_vrefint;
+	//    0.1 
+	temp = temp * vdda * 10 / ADC_FULL_SCALE;
+	fw_mcuTemp = (int16_t)(250 + ((int32_t)ADC_TEMP_V25_MV * 10 - (int32_t)temp) * 1000 / ADC_TEMP_SLOPE_UV);
+}
+
+// #FRAMEWORK# ------------------------------------------------
+// Description....:       adcCompensate()
+// Argument.......: 
+// ------------------------------------------------------------
+int16_t mcuTemperature(void) {
+	return fw_mcuTemp;
 }
 
 // #FRAMEWORK# ------------------------------------------------
 // Description....:         
+//									  49 :    (now - start)
 // Argument.......: 
 // ------------------------------------------------------------
-uint32_t millis(void) {
+RAMFUNC uint32_t millis(void) {
 	return msTicks;
 }
 
+// #FRAMEWORK# ------------------------------------------------
+// Description....:    
+// Argument.......: 
+// ------------------------------------------------------------
+uint64_t millis64(void) {
+	uint32_t high, low;
+	do {
+		high = fw_msHigh;
+		low = msTicks;
+	} while (high != fw_msHigh);
+	return ((uint64_t)high << 32) | low;
+}
+
+// #FRAMEWORK# ------------------------------------------------
+// Description....:    :    SysTick
+//									  DWT   .       - 
+// Argument.......: 
+// ------------------------------------------------------------
+uint64_t micros64(void) {
+	uint64_t base;
+	uint32_t tick, cycles;
+	do {
+		tick = msTicks;
+		base = fw_usBase;
+		cycles = DWT->CYCCNT - fw_cycAtTick;
+	} while (tick != msTicks);
+	return base + cycles / fw_cycPerUs;
+}
+
+// #FRAMEWORK# ------------------------------------------------
+// Description....:   (  71 :   )
+// Argument.......: 
+// ------------------------------------------------------------
+uint32_t micros(void) {
+	return (uint32_t)micros64();
+}
+
 // #FRAMEWORK# ------------------------------------------------
 // Description....:         
 // Argument.......: 
@@ -149,9 +301,9 @@ uint32_t millis(void) {
 // ------------------------------------------------------------
 void delay(uint32_t dlyTicks) {
   uint32_t curTicks = msTicks;
-	fwdgt_counter_reload();
   while ((msTicks - curTicks) < dlyTicks) {
-		__NOP();
+		//     (  SysTick)
+		__WFI();
 	}
 }
 
@@ -160,37 +312,28 @@ void delay(uint32_t dlyTicks) {
 // Argument.......: 
 // ------------------------------------------------------------
 void fw_init(void) {
+	//    DWT  micros()     -  
+	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+	DWT->CYCCNT = 0;
+	DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+	faultInit();
 	if (wd_init() == ERROR) while(1);
+	supInit();
+	bootMark(BOOT_WATCHDOG);
 	SystemCoreClockUpdate();
-  SysTick_Config(SystemCoreClock / 100);
+	fw_cycPerUs = SystemCoreClock / 1000000;
+	fw_cycPerTick = SystemCoreClock / TIMEOUT_FREQ;
+	fw_cycAtTick = DWT->CYCCNT;
+  SysTick_Config(fw_cycPerTick);
 	nvic_priority_group_set(NVIC_PRIGROUP_PRE4_SUB0);
+	mrInit();
+	bootMark(BOOT_CLOCK);
 	rcu_periph_clock_enable(RCU_GPIOA);
 	rcu_periph_clock_enable(RCU_GPIOB);
 	rcu_periph_clock_enable(RCU_GPIOC);
 	rcu_periph_clock_enable(RCU_GPIOF);
-	gpio_mode_set(getPort(PIN_HALL_A) , GPIO_MODE_INPUT, GPIO_PUPD_NONE, getPin(PIN_HALL_A));
-	gpio_mode_set(getPort(PIN_HALL_B) , GPIO_MODE_INPUT, GPIO_PUPD_NONE, getPin(PIN_HALL_B));
-	gpio_mode_set(getPort(PIN_HALL_C) , GPIO_MODE_INPUT, GPIO_PUPD_NONE, getPin(PIN_HALL_C));	
-	gpio_mode_set(getPort(PIN_BLDC_EMERGENCY_SHUTDOWN) , GPIO_MODE_AF, GPIO_PUPD_NONE, getPin(PIN_BLDC_EMERGENCY_SHUTDOWN));
-	gpio_af_set(getPort(PIN_BLDC_EMERGENCY_SHUTDOWN), GPIO_AF_2, getPin(PIN_BLDC_EMERGENCY_SHUTDOWN));
-	gpio_mode_set(getPort(PIN_BLDC_GH), GPIO_MODE_AF, GPIO_PUPD_NONE, getPin(PIN_BLDC_GH));
-	gpio_mode_set(getPort(PIN_BLDC_BH), GPIO_MODE_AF, GPIO_PUPD_NONE, getPin(PIN_BLDC_BH));
-	gpio_mode_set(getPort(PIN_BLDC_YH), GPIO_MODE_AF, GPIO_PUPD_NONE, getPin(PIN_BLDC_YH));
-	gpio_mode_set(getPort(PIN_BLDC_GL), GPIO_MODE_AF, GPIO_PUPD_NONE, getPin(PIN_BLDC_GL));
-	gpio_mode_set(getPort(PIN_BLDC_BL), GPIO_MODE_AF, GPIO_PUPD_NONE, getPin(PIN_BLDC_BL));
-	gpio_mode_set(getPort(PIN_BLDC_YL), GPIO_MODE_AF, GPIO_PUPD_NONE, getPin(PIN_BLDC_YL));
-	gpio_output_options_set(getPort(PIN_BLDC_GH), GPIO_OTYPE_PP, GPIO_OSPEED_2MHZ, getPin(PIN_BLDC_GH));
-  gpio_output_options_set(getPort(PIN_BLDC_BH), GPIO_OTYPE_PP, GPIO_OSPEED_2MHZ, getPin(PIN_BLDC_BH));
-  gpio_output_options_set(getPort(PIN_BLDC_YH), GPIO_OTYPE_PP, GPIO_OSPEED_2MHZ, getPin(PIN_BLDC_YH));
-	gpio_output_options_set(getPort(PIN_BLDC_GL), GPIO_OTYPE_PP, GPIO_OSPEED_2MHZ, getPin(PIN_BLDC_GL));
-  gpio_output_options_set(getPort(PIN_BLDC_BL), GPIO_OTYPE_PP, GPIO_OSPEED_2MHZ, getPin(PIN_BLDC_BL));
-  gpio_output_options_set(getPort(PIN_BLDC_YL), GPIO_OTYPE_PP, GPIO_OSPEED_2MHZ, getPin(PIN_BLDC_YL));
-	gpio_af_set(getPort(PIN_BLDC_GH), GPIO_AF_2, getPin(PIN_BLDC_GH));
-  gpio_af_set(getPort(PIN_BLDC_BH), GPIO_AF_2, getPin(PIN_BLDC_BH));
-	gpio_af_set(getPort(PIN_BLDC_YH), GPIO_AF_2, getPin(PIN_BLDC_YH));
-	gpio_af_set(getPort(PIN_BLDC_GL), GPIO_AF_2, getPin(PIN_BLDC_GL));
-  gpio_af_set(getPort(PIN_BLDC_BL), GPIO_AF_2, getPin(PIN_BLDC_BL));
-	gpio_af_set(getPort(PIN_BLDC_YL), GPIO_AF_2, getPin(PIN_BLDC_YL));
+	pinConfigApply(fw_pins, sizeof(fw_pins) / sizeof(fw_pins[0]));
+	bootMark(BOOT_GPIO);
 	rcu_periph_clock_enable(RCU_DMA);
 	
 	rcu_periph_clock_enable(RCU_ADC);
@@ -217,13 +360,17 @@ void fw_init(void) {
 	adc_data_alignment_config(ADC_DATAALIGN_RIGHT);
 	adc_external_trigger_config(ADC_REGULAR_CHANNEL, ENABLE);
 	adc_external_trigger_source_config(ADC_REGULAR_CHANNEL, ADC_EXTTRIG_REGULAR_NONE);
-	adc_tempsensor_vrefint_disable();
+	adc_tempsensor_vrefint_enable();
 	adc_vbat_disable();
 	adc_watchdog_disable();
 	adc_enable();
 	adc_calibration_enable();
 	adc_dma_mode_enable();
 	adc_special_function_config(ADC_SCAN_MODE, ENABLE);
+	//   Vrefint        -     1
+	bootDefer(adcCompensate);
+	schedAdd(adcCompensate, 1000, SCHED_PRIO_LOW);
+	bootMark(BOOT_ADC);
 	
 	rcu_periph_clock_enable(RCU_TIMER0);
 	timer_deinit(TIMER_BLDC);
@@ -272,6 +419,65 @@ void fw_init(void) {
 	nvic_irq_enable(TIMER0_BRK_UP_TRG_COM_IRQn, 0, 0);
 	timer_interrupt_enable(TIMER_BLDC, TIMER_INT_UP);
 	timer_enable(TIMER_BLDC);
+	bootMark(BOOT_TIMER);
+}
+
+// #FRAMEWORK# ------------------------------------------------
+// Description....:    
+// Argument.......: 
+//      uint8_t PHASE								=  (BOOT_*)
+// ------------------------------------------------------------
+void bootMark(uint8_t PHASE) {
+	if (PHASE < BOOT_PHASES && fw_bootStamp[PHASE] == 0) fw_bootStamp[PHASE] = DWT->CYCCNT;
+}
+
+// #FRAMEWORK# ------------------------------------------------
+// Description....:        fw_init() (, 0 -   )
+// Argument.......: 
+//      uint8_t PHASE								=  (BOOT_*)
+// ------------------------------------------------------------
+uint32_t bootPhase(uint8_t PHASE) {
+	if (PHASE >= BOOT_PHASES) return 0;
+	return fw_bootStamp[PHASE] / fw_cycPerUs;
+}
+
+// #FRAMEWORK# ------------------------------------------------
+// Description....:   fw_init()     ()
+// Argument.......: 
+// ------------------------------------------------------------
+uint32_t bootTime(void) {
+	return bootPhase(BOOT_TIMER);
+}
+
+// #FRAMEWORK# ------------------------------------------------
+// Description....:     (, , ):
+//									  ,     
+//									  , FUNC   (  ),
+//									 fw_bootDeferOverflow    ERROR
+// Argument.......: 
+//      bootFunc FUNC								=  
+// ------------------------------------------------------------
+ErrStatus bootDefer(bootFunc FUNC) {
+	if (FUNC == NULL) return ERROR;
+	if (fw_bootDeferCount >= BOOT_DEFER_MAX) {
+		fw_bootDeferOverflow++;
+		FUNC();
+		return ERROR;
+	}
+	fw_bootDeferred[fw_bootDeferCount++] = FUNC;
+	return SUCCESS;
+}
+
+// #FRAMEWORK# ------------------------------------------------
+// Description....:    (  schedRun()  )
+// Argument.......: 
+// ------------------------------------------------------------
+void bootDeferredRun(void) {
+	uint8_t i;
+	if (fw_bootDeferCount == 0) return;
+	for (i = 0; i < fw_bootDeferCount; i++) fw_bootDeferred[i]();
+	fw_bootDeferCount = 0;
+	bootMark(BOOT_DEFERRED);
 }
 
 // #FRAMEWORK# ------------------------------------------------
@@ -279,9 +485,6 @@ void fw_init(void) {
 // Argument.......: 
 // ------------------------------------------------------------
 ErrStatus wd_init(void) {
-	if (RESET != rcu_flag_get(RCU_FLAG_FWDGTRST)) {
-		rcu_all_reset_flag_clear();
-	}
 	if (fwdgt_config(0x0FFF, FWDGT_PSC_DIV16) != SUCCESS ||
 		fwdgt_window_value_config(0x0FFF) != SUCCESS) {
 		return ERROR;
@@ -295,7 +498,14 @@ ErrStatus wd_init(void) {
 // Argument.......: 
 // ------------------------------------------------------------
 void SysTick_Handler(void) {
-  msTicks++;
+	//    :      
+	//    .          
+	__disable_irq();
+	fw_cycAtTick += fw_cycPerTick;
+	fw_usBase += 1000000 / TIMEOUT_FREQ;
+	if (++msTicks == 0) fw_msHigh++;
+	__enable_irq();
+	supTick();
 }
 
 // #FRAMEWORK# ------------------------------------------------
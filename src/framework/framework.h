@@ -11,6 +11,7 @@
 
 	#include "gd32f1x0.h"
 	#include "../define.h"
+	#include "fixmath.h"
 
 	// 
 	//   
@@ -33,6 +34,15 @@
 	
 	//   
 	# define NULL													0x00
+	//     ,     (   )
+	# define NOINIT												__attribute__((section(".bss.noinit"), zero_init))
+	//    :     .    
+	//       ( RW_RAMCODE  KickScooter.sct)
+	#if RAMFUNC_ENABLE
+		# define RAMFUNC										__attribute__((section(".ramfunc")))
+	#else
+		# define RAMFUNC
+	#endif
 
 
 	//   
@@ -44,26 +54,30 @@
 		PF0, PF1, PF2, PF3, PF4, PF5, PF6, PF7, PF8, PF9, PF10, PF11, PF12, PF13, PF14, PF15
 	};
 	
+	//     :   PIN (PIN_*  define.h)
+	// ,      ,         
+	
 	// #FRAMEWORK# ------------------------------------------------
-	// Description....:     
+	// Description....:     
+	//									    0x400, GPIOE : PF (PIN >> 4 = 4)    
 	// Argument.......: 
 	//      uint8_t PIN									=    
 	// ------------------------------------------------------------
-	uint32_t getPort(uint8_t PIN);
+	# define getPort(PIN)									(GPIOA + (((uint32_t)(PIN) >> 4) + ((uint32_t)(PIN) >> 6)) * 0x400U)
 	
 	// #FRAMEWORK# ------------------------------------------------
-	// Description....:     
+	// Description....:     
 	// Argument.......: 
 	//      uint8_t PIN									=    
 	// ------------------------------------------------------------
-	uint32_t getPin(uint8_t PIN);
+	# define getPin(PIN)									BIT((PIN) & 0x0F)
 	
 	// #FRAMEWORK# ------------------------------------------------
-	// Description....:     
+	// Description....:      (PA0..PA7 -  0..7, PB0..PB1 - 8..9)
 	// Argument.......: 
 	//      uint8_t PIN									=    
 	// ------------------------------------------------------------
-	uint8_t getChannel(uint8_t PIN);
+	# define getChannel(PIN)							((uint8_t)((PIN) < PB0 ? (PIN) : (PIN) - PB0 + 8))
 	
 	// #FRAMEWORK# ------------------------------------------------
 	// Description....:   
@@ -84,15 +98,78 @@
 	//			FlagStatus fSTATUS					=   (. . framefork.h)
 	//					LOW											=  
 	//					HIGH										=  
+	//
+	//		   GPIO_BOP:  16   ,  - 
 	// ------------------------------------------------------------
-	void digitalWrite(uint8_t PIN, FlagStatus fSTATUS);
+	# define digitalWrite(PIN, fSTATUS)		(GPIO_BOP(getPort(PIN)) = getPin(PIN) << ((fSTATUS) ? 0 : 16))
 	
 	// #FRAMEWORK# ------------------------------------------------
 	// Description....:    
 	// Argument.......: 
 	//      uint8_t PIN									=    
 	// ------------------------------------------------------------
-	FlagStatus digitalRead(uint8_t PIN);
+	# define digitalRead(PIN)							((GPIO_ISTAT(getPort(PIN)) & getPin(PIN)) ? SET : RESET)
+	
+	//  :  /     
+	//     
+	# define PIN_GROUP_MAX								8
+	//   (A, B, C, D, -, F)
+	# define PIN_GROUP_PORTS							5
+	//  :  ,        ( )
+	# define PIN_STEP(PIN, BITNO)					{ (uint8_t)((PIN) >> 4), (uint16_t)getPin(PIN), (int8_t)(((PIN) & 0x0F) - (BITNO)) }
+	//       
+	# define PIN_GROUP_PORT(PIN)					BIT((PIN) >> 4)
+
+	typedef struct {
+		uint8_t port;
+		uint16_t mask;
+		int8_t shift;
+	} pinStep;
+
+	// : const pinGroup hall = { PIN_GROUP_PORT(PB11) | PIN_GROUP_PORT(PF1), 2, { PIN_STEP(PB11, 0), PIN_STEP(PF1, 1) } };
+	typedef struct {
+		uint8_t ports;
+		uint8_t count;
+		pinStep step[PIN_GROUP_MAX];
+	} pinGroup;
+
+	// #FRAMEWORK# ------------------------------------------------
+	// Description....:   :       ,
+	//									       ( N -  PIN_STEP(PIN, N))
+	// Argument.......: 
+	//      const pinGroup *GROUP				=  
+	// ------------------------------------------------------------
+	uint32_t pinGroupRead(const pinGroup *GROUP);
+
+	// #FRAMEWORK# ------------------------------------------------
+	// Description....:   :    GPIO_BOP   (  
+	//									 )
+	// Argument.......: 
+	//      const pinGroup *GROUP				=  
+	//      uint32_t VALUE							=   ( N -  PIN_STEP(PIN, N))
+	// ------------------------------------------------------------
+	void pinGroupWrite(const pinGroup *GROUP, uint32_t VALUE);
+
+	//    (  ): , ,    ,  
+	# define PIN_CONFIG(PIN, MODE, PUPD, OTYPE, OSPEED, AF)	{ (uint8_t)(PIN), (uint8_t)(MODE), (uint8_t)(PUPD), (uint8_t)(OTYPE), (uint8_t)(OSPEED), (uint8_t)(AF) }
+
+	typedef struct {
+		uint8_t pin;
+		uint8_t mode;
+		uint8_t pupd;
+		uint8_t otype;
+		uint8_t ospeed;
+		uint8_t af;
+	} pinConfig;
+
+	// #FRAMEWORK# ------------------------------------------------
+	// Description....:    :       ,
+	//									      ( - ,   AF)
+	// Argument.......: 
+	//      const pinConfig *TABLE			=  
+	//      uint8_t COUNT								=  
+	// ------------------------------------------------------------
+	void pinConfigApply(const pinConfig *TABLE, uint8_t COUNT);
 	
 	// #FRAMEWORK# ------------------------------------------------
 	// Description....:    
@@ -101,12 +178,108 @@
 	// ------------------------------------------------------------
 	uint16_t analogRead(uint8_t PIN);
 	
+	// #FRAMEWORK# ------------------------------------------------
+	// Description....:         VDDA
+	//									   ADC_VDDA_MV,  CONST_*   
+	// Argument.......: 
+	//      uint8_t PIN									=    
+	// ------------------------------------------------------------
+	uint16_t analogReadComp(uint8_t PIN);
+	
+	// #FRAMEWORK# ------------------------------------------------
+	// Description....:       
+	//									  Vrefint  ,  
+	// Argument.......: 
+	//      uint8_t PIN									=    
+	//			q16_t K											=      Q16 ( CONST_BATTERY_MV_Q16)
+	// ------------------------------------------------------------
+	uint32_t analogReadScaled(uint8_t PIN, q16_t K);
+	
+	// #FRAMEWORK# ------------------------------------------------
+	// Description....:     Vrefint   
+	//									  (   )
+	// Argument.......: 
+	// ------------------------------------------------------------
+	void adcCompensate(void);
+	
+	// #FRAMEWORK# ------------------------------------------------
+	// Description....:    (0.1C)    adcCompensate()
+	// Argument.......: 
+	// ------------------------------------------------------------
+	int16_t mcuTemperature(void);
+	
 	// #FRAMEWORK# ------------------------------------------------
 	// Description....:         
+	//									  49 :    (now - start)
 	// Argument.......: 
 	// ------------------------------------------------------------
 	uint32_t millis(void);
 	
+	// #FRAMEWORK# ------------------------------------------------
+	// Description....:    
+	// Argument.......: 
+	// ------------------------------------------------------------
+	uint64_t millis64(void);
+	
+	// #FRAMEWORK# ------------------------------------------------
+	// Description....:     (  DWT +  SysTick)
+	// Argument.......: 
+	// ------------------------------------------------------------
+	uint64_t micros64(void);
+	
+	// #FRAMEWORK# ------------------------------------------------
+	// Description....:   (  71 :   )
+	// Argument.......: 
+	// ------------------------------------------------------------
+	uint32_t micros(void);
+	
+	//  :     fw_bootStamp (     fw_init),
+	//     SWD   
+	enum BOOT_PHASE {
+		BOOT_WATCHDOG, BOOT_CLOCK, BOOT_GPIO, BOOT_ADC, BOOT_TIMER, BOOT_MOTOR, BOOT_DEFERRED, BOOT_PHASES
+	};
+	//    : adcCompensate, batteryRestore, telemetryStart,
+	// commandStart, linkStart, ninebotStart -        AUX_PROTOCOL
+	# define BOOT_DEFER_MAX								6
+
+	typedef void (*bootFunc)(void);
+
+	// #FRAMEWORK# ------------------------------------------------
+	// Description....:    
+	// Argument.......: 
+	//      uint8_t PHASE								=  (BOOT_*)
+	// ------------------------------------------------------------
+	void bootMark(uint8_t PHASE);
+
+	// #FRAMEWORK# ------------------------------------------------
+	// Description....:        fw_init() (, 0 -   )
+	// Argument.......: 
+	//      uint8_t PHASE								=  (BOOT_*)
+	// ------------------------------------------------------------
+	uint32_t bootPhase(uint8_t PHASE);
+
+	// #FRAMEWORK# ------------------------------------------------
+	// Description....:   fw_init()     ()
+	// Argument.......: 
+	// ------------------------------------------------------------
+	uint32_t bootTime(void);
+
+	// #FRAMEWORK# ------------------------------------------------
+	// Description....:     (, , ):
+	//									  ,     
+	//									  , FUNC   (  ),
+	//									 fw_bootDeferOverflow    ERROR
+	// Argument.......: 
+	//      bootFunc FUNC								=  
+	// ------------------------------------------------------------
+	ErrStatus bootDefer(bootFunc FUNC);
+
+	// #FRAMEWORK# ------------------------------------------------
+	// Description....:    (  schedRun()  )
+	// Argument.......: 
+	// ------------------------------------------------------------
+	void bootDeferredRun(void);
+	
 	// #FRAMEWORK# ------------------------------------------------
 	// Description....:         
 	// Argument.......: 
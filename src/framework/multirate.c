@@ -0,0 +1,114 @@
+// #INDEX# ======================================================================================================
+// Title .........:  :        
+// Arch ..........: GD32F130C8C6
+// Author ........: GreenBytes ( https://vk.com/greenbytes )
+// Version .......: 1.0.0.0
+// ==============================================================================================================
+
+//  
+//      
+#include "gd32f1x0.h"
+//   
+#include "multirate.h"
+//  
+#include "framework.h"
+//    
+#include "../define.h"
+
+//   
+# define MR_SPEED_DIV										(PWM_FREQ / MR_SPEED_HZ)
+# define MR_SUPER_DIV										(PWM_FREQ / MR_SUPER_HZ)
+
+FIX_STATIC_ASSERT(MR_SPEED_DIV * MR_SPEED_HZ == PWM_FREQ && MR_SUPER_DIV * MR_SUPER_HZ == PWM_FREQ, mr_divider);
+
+//  
+mrFunc mr_slice[MR_SLICES] = { NULL, NULL };
+//      
+volatile uint8_t mr_busy[MR_SLICES] = { 0, 0 };
+//  
+uint32_t mr_overruns[MR_SLICES] = { 0, 0 };
+//  
+uint16_t mr_speedDiv = 0;
+uint16_t mr_superDiv = 0;
+
+// #MULTIRATE# ------------------------------------------------
+// Description....:   SysTick, PendSV   
+// Argument.......: 
+// ------------------------------------------------------------
+void mrInit(void) {
+	NVIC_SetPriority(SysTick_IRQn, MR_PRIO_TICK);
+	NVIC_SetPriority(PendSV_IRQn, MR_PRIO_SPEED);
+	nvic_irq_enable(TSI_IRQn, MR_PRIO_SUPER, 0);
+}
+
+// #MULTIRATE# ------------------------------------------------
+// Description....:   
+// Argument.......:
+//      uint8_t SLICE								=  (MR_SLICE_SPEED, MR_SLICE_SUPER)
+//      mrFunc FUNC									=   (NULL - )
+// ------------------------------------------------------------
+void mrAttach(uint8_t SLICE, mrFunc FUNC) {
+	if (SLICE < MR_SLICES) mr_slice[SLICE] = FUNC;
+}
+
+// #MULTIRATE# ------------------------------------------------
+// Description....:    .   mrTick()    ;
+//									     ,  NVIC_SetPendingIRQ()
+// Argument.......:
+//      uint8_t SLICE								= 
+// ------------------------------------------------------------
+static RAMFUNC void mrPend(uint8_t SLICE) {
+	if (mr_slice[SLICE] == NULL) return;
+	if (mr_busy[SLICE]) {
+		mr_overruns[SLICE]++;
+		return;
+	}
+	mr_busy[SLICE] = 1;
+	if (SLICE == MR_SLICE_SPEED) SCB->ICSR = SCB_ICSR_PENDSVSET_Msk;
+	else NVIC->ISPR[(uint32_t)TSI_IRQn >> 5] = 1UL << ((uint32_t)TSI_IRQn & 0x1F);
+}
+
+// #MULTIRATE# ------------------------------------------------
+// Description....:   :       
+//									 .     (enginePWM)
+// Argument.......: 
+// ------------------------------------------------------------
+RAMFUNC void mrTick(void) {
+	if (++mr_speedDiv >= MR_SPEED_DIV) {
+		mr_speedDiv = 0;
+		mrPend(MR_SLICE_SPEED);
+	}
+	if (++mr_superDiv >= MR_SUPER_DIV) {
+		mr_superDiv = 0;
+		mrPend(MR_SLICE_SUPER);
+	}
+}
+
+// #MULTIRATE# ------------------------------------------------
+// Description....:    (      )
+// Argument.......:
+//      uint8_t SLICE								=  (MR_SLICE_SPEED, MR_SLICE_SUPER)
+// ------------------------------------------------------------
+uint32_t mrOverruns(uint8_t SLICE) {
+	return (SLICE < MR_SLICES) ? mr_overruns[SLICE] : 0;
+}
+
+// #MULTIRATE# ------------------------------------------------
+// Description....:   
+// Argument.......: 
+// ------------------------------------------------------------
+void PendSV_Handler(void) {
+	mrFunc func = mr_slice[MR_SLICE_SPEED];
+	if (func != NULL) func();
+	mr_busy[MR_SLICE_SPEED] = 0;
+}
+
+// #MULTIRATE# ------------------------------------------------
+// Description....:   ( TSI   )
+// Argument.......: 
+// ------------------------------------------------------------
+void TSI_IRQHandler(void) {
+	mrFunc func = mr_slice[MR_SLICE_SUPER];
+	if (func != NULL) func();
+	mr_busy[MR_SLICE_SUPER] = 0;
+}
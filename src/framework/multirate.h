@@ -0,0 +1,61 @@
+// #INDEX# ======================================================================================================
+// Title .........:  :        
+// Arch ..........: GD32F130C8C6
+// Author ........: GreenBytes ( https://vk.com/greenbytes )
+// Version .......: 1.0.0.0
+// ==============================================================================================================
+
+#ifndef MULTIRATE_H
+
+	#define MULTIRATE_H
+
+	#include "gd32f1x0.h"
+	#include "../define.h"
+
+	// 
+	// 
+	//   (MR_SPEED_HZ),   PendSV
+	# define MR_SLICE_SPEED							0
+	//  (MR_SUPER_HZ),   TSI   
+	# define MR_SLICE_SUPER							1
+	//  
+	# define MR_SLICES									2
+	//   ( - ):  (TIMER0) - 0
+	# define MR_PRIO_TICK								1
+	# define MR_PRIO_SPEED							2
+	# define MR_PRIO_SUPER							3
+
+	//  :   ,      
+	typedef void (*mrFunc)(void);
+
+	// #MULTIRATE# ------------------------------------------------
+	// Description....:   SysTick, PendSV   
+	// Argument.......: 
+	// ------------------------------------------------------------
+	void mrInit(void);
+
+	// #MULTIRATE# ------------------------------------------------
+	// Description....:   
+	// Argument.......:
+	//      uint8_t SLICE								=  (MR_SLICE_SPEED, MR_SLICE_SUPER)
+	//      mrFunc FUNC									=   (NULL - )
+	// ------------------------------------------------------------
+	void mrAttach(uint8_t SLICE, mrFunc FUNC);
+
+	// #MULTIRATE# ------------------------------------------------
+	// Description....:   :       
+	//									 .     (enginePWM)
+	// Argument.......: 
+	// ------------------------------------------------------------
+	void mrTick(void);
+
+	// #MULTIRATE# ------------------------------------------------
+	// Description....:    (      )
+	// Argument.......:
+	//      uint8_t SLICE								=  (MR_SLICE_SPEED, MR_SLICE_SUPER)
+	// ------------------------------------------------------------
+	uint32_t mrOverruns(uint8_t SLICE);
+
+	void PendSV_Handler(void);
+	void TSI_IRQHandler(void);
+#endif
@@ -0,0 +1,115 @@
+// #INDEX# ======================================================================================================
+// Title .........:      ( ,  )   
+// Arch ..........: GD32F130C8C6
+// Author ........: GreenBytes ( https://vk.com/greenbytes )
+// Version .......: 1.0.0.0
+// ==============================================================================================================
+
+#ifndef RING_H
+
+	#define RING_H
+
+	#include "gd32f1x0.h"
+	#include <string.h>
+
+	//  head (  )  tail (  )   ,
+	//    -   .  -  ,   32768 
+	typedef struct {
+		volatile uint16_t head;
+		volatile uint16_t tail;
+		uint16_t mask;
+		uint16_t size;
+		uint8_t *data;
+	} ringBuf;
+
+	//   : COUNT   SIZE 
+	// : RING_DEFINE(hall_ring, sizeof(uint16_t), 16);
+	# define RING_DEFINE(NAME, SIZE, COUNT)\
+		typedef char NAME##_pow2[(((COUNT) & ((COUNT) - 1)) == 0 && (COUNT) <= 32768) ? 1 : -1];\
+		uint8_t NAME##_data[(SIZE) * (COUNT)];\
+		ringBuf NAME = { 0, 0, (COUNT) - 1, (SIZE), NAME##_data }
+
+	// #RING# -----------------------------------------------------
+	// Description....:    
+	// Argument.......:
+	//      const ringBuf *RING					= 
+	// ------------------------------------------------------------
+	static __INLINE uint16_t ringCount(const ringBuf *RING) {
+		return (uint16_t)(RING->head - RING->tail);
+	}
+
+	// #RING# -----------------------------------------------------
+	// Description....:   ( ). ERROR -  
+	// Argument.......:
+	//      ringBuf *RING								= 
+	//      const void *ITEM						= 
+	// ------------------------------------------------------------
+	static __INLINE ErrStatus ringPush(ringBuf *RING, const void *ITEM) {
+		uint16_t head = RING->head;
+		if ((uint16_t)(head - RING->tail) > RING->mask) return ERROR;
+		memcpy(&RING->data[(uint32_t)(head & RING->mask) * RING->size], ITEM, RING->size);
+		//    ,     head
+		__DMB();
+		RING->head = (uint16_t)(head + 1);
+		return SUCCESS;
+	}
+
+	// #RING# -----------------------------------------------------
+	// Description....:   ( ). ERROR -  
+	// Argument.......:
+	//      ringBuf *RING								= 
+	//      void *ITEM									=   
+	// ------------------------------------------------------------
+	static __INLINE ErrStatus ringPop(ringBuf *RING, void *ITEM) {
+		uint16_t tail = RING->tail;
+		if (RING->head == tail) return ERROR;
+		//    head,     
+		__DMB();
+		memcpy(ITEM, &RING->data[(uint32_t)(tail & RING->mask) * RING->size], RING->size);
+		__DMB();
+		RING->tail = (uint16_t)(tail + 1);
+		return SUCCESS;
+	}
+
+	//  
+	typedef struct {
+		//   (EVENT_*  define.h)
+		uint8_t type;
+		//  
+		uint8_t arg;
+		uint16_t value;
+		//   ()
+		uint32_t time;
+	} event;
+
+	//      COUNT 
+	# define EVENT_QUEUE_DEFINE(NAME, COUNT)			RING_DEFINE(NAME, sizeof(event), COUNT)
+
+	// #RING# -----------------------------------------------------
+	// Description....:     ( ). ERROR -  
+	// Argument.......:
+	//      ringBuf *QUEUE							= 
+	//      uint8_t TYPE								=  
+	//      uint8_t ARG									= 
+	//      uint16_t VALUE							= 
+	//      uint32_t TIME								=   ()
+	// ------------------------------------------------------------
+	static __INLINE ErrStatus eventPost(ringBuf *QUEUE, uint8_t TYPE, uint8_t ARG, uint16_t VALUE, uint32_t TIME) {
+		event evt;
+		evt.type = TYPE;
+		evt.arg = ARG;
+		evt.value = VALUE;
+		evt.time = TIME;
+		return ringPush(QUEUE, &evt);
+	}
+
+	// #RING# -----------------------------------------------------
+	// Description....:     ( ). ERROR -  
+	// Argument.......:
+	//      ringBuf *QUEUE							= 
+	//      event *EVT									=   
+	// ------------------------------------------------------------
+	static __INLINE ErrStatus eventGet(ringBuf *QUEUE, event *EVT) {
+		return ringPop(QUEUE, EVT);
+	}
+#endif
@@ -0,0 +1,131 @@
+// #INDEX# ======================================================================================================
+// Title .........:   
+// Arch ..........: GD32F130C8C6
+// Author ........: GreenBytes ( https://vk.com/greenbytes )
+// Version .......: 1.0.0.0
+// ==============================================================================================================
+
+//  
+//      
+#include "gd32f1x0.h"
+//  
+#include "scheduler.h"
+//  
+#include "framework.h"
+#include "supervisor.h"
+//    
+#include "../define.h"
+
+//     ,    -  
+FIX_STATIC_ASSERT(SUP_MAX_CLIENTS > SCHED_MAX_TASKS, sched_sup_clients);
+
+//  
+typedef struct {
+	schedFunc func;
+	uint32_t period;
+	uint32_t next;
+	uint8_t priority;
+	int8_t supId;
+	schedStat stat;
+} schedTask;
+
+//  
+schedTask sched_tasks[SCHED_MAX_TASKS];
+//  
+uint8_t sched_count = 0;
+// ,     ( ):   -  SCHED_MAX_TASKS
+uint8_t sched_overflow = 0;
+//   (NULL -   ),    SysTick
+schedTask * volatile sched_current = NULL;
+
+// #SCHEDULER# ------------------------------------------------
+// Description....:   ,    (-1 - )
+//									  ,   sched_overflow
+// Argument.......:
+//      schedFunc FUNC							=  
+//      uint32_t PERIOD							=  ()
+//      uint8_t PRIORITY						=  (SCHED_PRIO_*)
+// ------------------------------------------------------------
+int8_t schedAdd(schedFunc FUNC, uint32_t PERIOD, uint8_t PRIORITY) {
+	schedTask *task;
+	if (FUNC == NULL || PERIOD == 0) return -1;
+	if (sched_count >= SCHED_MAX_TASKS) {
+		sched_overflow++;
+		return -1;
+	}
+	task = &sched_tasks[sched_count];
+	task->func = FUNC;
+	task->period = PERIOD * 1000;
+	task->priority = PRIORITY;
+	task->next = micros() + task->period;
+	//   ,        
+	task->supId = supRegister((const void *)FUNC, PERIOD * 2 + SUP_SLACK_MS);
+	task->stat.runs = 0;
+	task->stat.lastUs = 0;
+	task->stat.maxUs = 0;
+	task->stat.maxLateUs = 0;
+	task->stat.skipped = 0;
+	return (int8_t)sched_count++;
+}
+
+// #SCHEDULER# ------------------------------------------------
+// Description....:   :  ,   , 
+//									   .    
+//									 SET,   , RESET -   
+//									(    WFI   )
+// Argument.......: 
+// ------------------------------------------------------------
+FlagStatus schedRun(void) {
+	schedTask *task = NULL;
+	uint32_t now = micros();
+	uint32_t late, start;
+	uint8_t i;
+	//      -  micros()  
+	for (i = 0; i < sched_count; i++) {
+		if ((int32_t)(now - sched_tasks[i].next) < 0) continue;
+		if (task == NULL || sched_tasks[i].priority < task->priority) task = &sched_tasks[i];
+	}
+	if (task == NULL) {
+		//    :  ,   
+		bootDeferredRun();
+		//  :     (SysTick, , UART)
+		__WFI();
+		return RESET;
+	}
+	late = now - task->next;
+	if (late > task->stat.maxLateUs) task->stat.maxLateUs = late;
+	//     -   ;     
+	task->next += task->period;
+	if (late >= task->period) {
+		task->stat.skipped += late / task->period;
+		task->next = now + task->period;
+	}
+	start = micros();
+	sched_current = task;
+	task->func();
+	sched_current = NULL;
+	task->stat.lastUs = micros() - start;
+	if (task->stat.lastUs > task->stat.maxUs) task->stat.maxUs = task->stat.lastUs;
+	task->stat.runs++;
+	supCheckIn(task->supId);
+	return SET;
+}
+
+// #SCHEDULER# ------------------------------------------------
+// Description....:      (-1 -   )
+// Argument.......: 
+// ------------------------------------------------------------
+int8_t schedCurrent(void) {
+	schedTask *task = sched_current;
+	return (task != NULL) ? task->supId : -1;
+}
+
+// #SCHEDULER# ------------------------------------------------
+// Description....:  
+// Argument.......:
+//      int8_t ID										=   ( schedAdd)
+// ------------------------------------------------------------
+const schedStat *schedStats(int8_t ID) {
+	if (ID < 0 || ID >= sched_count) return NULL;
+	return &sched_tasks[ID].stat;
+}
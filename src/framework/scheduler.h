@@ -0,0 +1,73 @@
+// #INDEX# ======================================================================================================
+// Title .........:   
+// Arch ..........: GD32F130C8C6
+// Author ........: GreenBytes ( https://vk.com/greenbytes )
+// Version .......: 1.0.0.0
+// ==============================================================================================================
+
+#ifndef SCHEDULER_H
+
+	#define SCHEDULER_H
+
+	#include "gd32f1x0.h"
+	#include "../define.h"
+
+	// 
+	//   :     4,    4,  4
+	# define SCHED_MAX_TASKS						12
+	//   ( - )
+	//  (, )
+	# define SCHED_PRIO_HIGH						0
+	//  ,  
+	# define SCHED_PRIO_NORMAL					1
+	// , ,  
+	# define SCHED_PRIO_LOW							2
+
+	// :   ,   ( delay())
+	typedef void (*schedFunc)(void);
+
+	//  
+	typedef struct {
+		//  
+		uint32_t runs;
+		//  :    ()
+		uint32_t lastUs;
+		uint32_t maxUs;
+		//      ()
+		uint32_t maxLateUs;
+		//   (  )
+		uint32_t skipped;
+	} schedStat;
+
+	// #SCHEDULER# ------------------------------------------------
+	// Description....:   ,    (-1 - )
+	//									  ,   sched_overflow
+	// Argument.......:
+	//      schedFunc FUNC							=  
+	//      uint32_t PERIOD							=  ()
+	//      uint8_t PRIORITY						=  (SCHED_PRIO_*)
+	// ------------------------------------------------------------
+	int8_t schedAdd(schedFunc FUNC, uint32_t PERIOD, uint8_t PRIORITY);
+
+	// #SCHEDULER# ------------------------------------------------
+	// Description....:   :  ,   , 
+	//									   .    
+	//									 SET,   , RESET -   
+	//									(    WFI   )
+	// Argument.......: 
+	// ------------------------------------------------------------
+	FlagStatus schedRun(void);
+
+	// #SCHEDULER# ------------------------------------------------
+	// Description....:      (-1 -   )
+	// Argument.......: 
+	// ------------------------------------------------------------
+	int8_t schedCurrent(void);
+
+	// #SCHEDULER# ------------------------------------------------
+	// Description....:  
+	// Argument.......:
+	//      int8_t ID										=   ( schedAdd)
+	// ------------------------------------------------------------
+	const schedStat *schedStats(int8_t ID);
+#endif
@@ -0,0 +1,96 @@
+// #INDEX# ======================================================================================================
+// Title .........:   ,      (seqlock)
+// Arch ..........: GD32F130C8C6
+// Author ........: GreenBytes ( https://vk.com/greenbytes )
+// Version .......: 1.0.0.0
+// ==============================================================================================================
+
+#ifndef SEQLOCK_H
+
+	#define SEQLOCK_H
+
+	#include "gd32f1x0.h"
+	#include <string.h>
+
+	//  :  -  .   (),  - 
+	//    :     ,  , 
+	// , .   
+	//     (__forceinline):    
+	// (RAMFUNC),     -O0,   __INLINE    
+	//    
+	typedef struct {
+		volatile uint32_t seq;
+	} seqLock;
+
+	// #SEQLOCK# --------------------------------------------------
+	// Description....:  
+	// Argument.......:
+	//      seqLock *LOCK								=  
+	// ------------------------------------------------------------
+	static __forceinline void seqWriteBegin(seqLock *LOCK) {
+		LOCK->seq++;
+		__DMB();
+	}
+
+	// #SEQLOCK# --------------------------------------------------
+	// Description....:  
+	// Argument.......:
+	//      seqLock *LOCK								=  
+	// ------------------------------------------------------------
+	static __forceinline void seqWriteEnd(seqLock *LOCK) {
+		__DMB();
+		LOCK->seq++;
+	}
+
+	// #SEQLOCK# --------------------------------------------------
+	// Description....:  ,    seqReadRetry()
+	// Argument.......:
+	//      const seqLock *LOCK					=  
+	// ------------------------------------------------------------
+	static __INLINE uint32_t seqReadBegin(const seqLock *LOCK) {
+		uint32_t seq = LOCK->seq;
+		__DMB();
+		return seq;
+	}
+
+	// #SEQLOCK# --------------------------------------------------
+	// Description....:  : SET -     ,  
+	// Argument.......:
+	//      const seqLock *LOCK					=  
+	//      uint32_t SEQ								=   seqReadBegin()
+	// ------------------------------------------------------------
+	static __INLINE FlagStatus seqReadRetry(const seqLock *LOCK, uint32_t SEQ) {
+		__DMB();
+		return ((SEQ & 1) || LOCK->seq != SEQ) ? SET : RESET;
+	}
+
+	// #SEQLOCK# --------------------------------------------------
+	// Description....:   ( )
+	// Argument.......:
+	//      seqLock *LOCK								=  
+	//      void *DST										=  
+	//      const void *SRC							=  
+	//      uint32_t SIZE								=  
+	// ------------------------------------------------------------
+	static __INLINE void seqPublish(seqLock *LOCK, void *DST, const void *SRC, uint32_t SIZE) {
+		seqWriteBegin(LOCK);
+		memcpy(DST, SRC, SIZE);
+		seqWriteEnd(LOCK);
+	}
+
+	// #SEQLOCK# --------------------------------------------------
+	// Description....:     ( )
+	// Argument.......:
+	//      const seqLock *LOCK					=  
+	//      void *DST										=  
+	//      const void *SRC							=  
+	//      uint32_t SIZE								=  
+	// ------------------------------------------------------------
+	static __INLINE void seqSnapshot(const seqLock *LOCK, void *DST, const void *SRC, uint32_t SIZE) {
+		uint32_t seq;
+		do {
+			seq = seqReadBegin(LOCK);
+			memcpy(DST, SRC, SIZE);
+		} while (seqReadRetry(LOCK, seq) == SET);
+	}
+#endif
@@ -0,0 +1,220 @@
+// #INDEX# ======================================================================================================
+// Title .........:   USART:   DMA,     DMA
+// Arch ..........: GD32F130C8C6
+// Author ........: GreenBytes ( https://vk.com/greenbytes )
+// Version .......: 1.0.0.0
+// ==============================================================================================================
+
+//  
+//      
+#include "gd32f1x0.h"
+//   
+#include "serial.h"
+//  
+#include "framework.h"
+//    
+#include "../define.h"
+
+//  
+typedef struct {
+	uint32_t usart;
+	rcu_periph_enum rcu;
+	dma_channel_enum txDma;
+	dma_channel_enum rxDma;
+	IRQn_Type irq;
+} serialHw;
+
+static const serialHw serial_hw[SERIAL_PORTS] = {
+	{ USART1, RCU_USART1, DMA_CH3, DMA_CH4, USART1_IRQn },
+	{ USART0, RCU_USART0, DMA_CH1, DMA_CH2, USART0_IRQn }
+};
+
+//    ( DMA),       
+typedef struct {
+	uint8_t buf[SERIAL_RX_SIZE];
+	uint16_t tail;
+	serialFunc onIdle;
+	FlagStatus open;
+} serialRx;
+
+FIX_STATIC_ASSERT((SERIAL_RX_SIZE & (SERIAL_RX_SIZE - 1)) == 0, serial_rx_size);
+
+serialRx serial_rx[SERIAL_PORTS];
+
+//  : TX -  , RX -   (    )
+static const pinConfig serial_pins[SERIAL_PORTS][2] = {
+	{
+		PIN_CONFIG(PIN_AUX_TX, GPIO_MODE_AF, GPIO_PUPD_PULLUP, GPIO_OTYPE_PP, GPIO_OSPEED_10MHZ, GPIO_AF_1),
+		PIN_CONFIG(PIN_AUX_RX, GPIO_MODE_AF, GPIO_PUPD_PULLUP, GPIO_OTYPE_PP, GPIO_OSPEED_10MHZ, GPIO_AF_1)
+	},
+	{
+		PIN_CONFIG(PIN_LINK_TX, GPIO_MODE_AF, GPIO_PUPD_PULLUP, GPIO_OTYPE_PP, GPIO_OSPEED_10MHZ, GPIO_AF_0),
+		PIN_CONFIG(PIN_LINK_RX, GPIO_MODE_AF, GPIO_PUPD_PULLUP, GPIO_OTYPE_PP, GPIO_OSPEED_10MHZ, GPIO_AF_0)
+	}
+};
+
+// #SERIAL# ---------------------------------------------------
+// Description....:  : 8N1,   DMA,    DMA  
+//									.         
+//									      
+// Argument.......:
+//      uint8_t PORT								=  (SERIAL_*)
+//      uint32_t BAUD								=  ()
+//      uint8_t MODE								=  (SERIAL_MODE_*)
+// ------------------------------------------------------------
+void serialInit(uint8_t PORT, uint32_t BAUD, uint8_t MODE) {
+	const serialHw *hw = &serial_hw[PORT];
+	dma_parameter_struct dma;
+	pinConfig wire;
+	if (serial_rx[PORT].open == SET) return;
+	serial_rx[PORT].open = SET;
+	rcu_periph_clock_enable(hw->rcu);
+	rcu_periph_clock_enable(RCU_DMA);
+	if (MODE == SERIAL_MODE_HALF) {
+		//  :     ,    
+		wire = serial_pins[PORT][0];
+		wire.otype = GPIO_OTYPE_OD;
+		pinConfigApply(&wire, 1);
+	} else {
+		pinConfigApply(serial_pins[PORT], 2);
+	}
+	usart_deinit(hw->usart);
+	usart_baudrate_set(hw->usart, BAUD);
+	usart_word_length_set(hw->usart, USART_WL_8BIT);
+	usart_stop_bit_set(hw->usart, USART_STB_1BIT);
+	usart_parity_config(hw->usart, USART_PM_NONE);
+	usart_transmit_config(hw->usart, USART_TRANSMIT_ENABLE);
+	usart_receive_config(hw->usart, USART_RECEIVE_ENABLE);
+	if (MODE == SERIAL_MODE_HALF) usart_halfduplex_enable(hw->usart);
+	usart_dma_transmit_config(hw->usart, USART_DENT_ENABLE);
+	usart_dma_receive_config(hw->usart, USART_DENR_ENABLE);
+	//    : DMA   ,   
+	//   
+	usart_overrun_disable(hw->usart);
+	//  :       serialSend()
+	dma_deinit(hw->txDma);
+	dma.direction = DMA_MEMORY_TO_PERIPHERAL;
+	dma.memory_addr = 0;
+	dma.memory_inc = DMA_MEMORY_INCREASE_ENABLE;
+	dma.memory_width = DMA_MEMORY_WIDTH_8BIT;
+	dma.number = 0;
+	dma.periph_addr = (uint32_t)&USART_TDATA(hw->usart);
+	dma.periph_inc = DMA_PERIPH_INCREASE_DISABLE;
+	dma.periph_width = DMA_PERIPHERAL_WIDTH_8BIT;
+	dma.priority = DMA_PRIORITY_LOW;
+	dma_init(hw->txDma, &dma);
+	dma_circulation_disable(hw->txDma);
+	dma_memory_to_memory_disable(hw->txDma);
+	//  :  ,  ,   -   DMA
+	dma_deinit(hw->rxDma);
+	dma.direction = DMA_PERIPHERAL_TO_MEMORY;
+	dma.memory_addr = (uint32_t)serial_rx[PORT].buf;
+	dma.number = SERIAL_RX_SIZE;
+	dma.periph_addr = (uint32_t)&USART_RDATA(hw->usart);
+	dma.priority = DMA_PRIORITY_MEDIUM;
+	dma_init(hw->rxDma, &dma);
+	dma_circulation_enable(hw->rxDma);
+	dma_memory_to_memory_disable(hw->rxDma);
+	dma_channel_enable(hw->rxDma);
+	serial_rx[PORT].tail = 0;
+	//      :   ,     
+	usart_interrupt_enable(hw->usart, USART_INT_IDLE);
+	nvic_irq_enable(hw->irq, SERIAL_PRIO, 0);
+	usart_enable(hw->usart);
+}
+
+// #SERIAL# ---------------------------------------------------
+// Description....:    DMA  .   ,  serialBusy() = SET
+//									 ERROR,     
+// Argument.......:
+//      uint8_t PORT								=  (SERIAL_*)
+//      const uint8_t *DATA					= 
+//      uint16_t LEN								= 
+// ------------------------------------------------------------
+ErrStatus serialSend(uint8_t PORT, const uint8_t *DATA, uint16_t LEN) {
+	dma_channel_enum ch = serial_hw[PORT].txDma;
+	if (LEN == 0 || (DMA_CHCNT(ch) != 0 && (DMA_CHCTL(ch) & DMA_CHXCTL_CHEN))) return ERROR;
+	//   -    ,  
+	DMA_CHCTL(ch) &= ~DMA_CHXCTL_CHEN;
+	DMA_CHMADDR(ch) = (uint32_t)DATA;
+	DMA_CHCNT(ch) = LEN;
+	DMA_CHCTL(ch) |= DMA_CHXCTL_CHEN;
+	return SUCCESS;
+}
+
+// #SERIAL# ---------------------------------------------------
+// Description....:    (DMA         )
+// Argument.......:
+//      uint8_t PORT								=  (SERIAL_*)
+// ------------------------------------------------------------
+FlagStatus serialBusy(uint8_t PORT) {
+	const serialHw *hw = &serial_hw[PORT];
+	if (DMA_CHCNT(hw->txDma) != 0 && (DMA_CHCTL(hw->txDma) & DMA_CHXCTL_CHEN)) return SET;
+	return (usart_flag_get(hw->usart, USART_FLAG_TC) == SET) ? RESET : SET;
+}
+
+// #SERIAL# ---------------------------------------------------
+// Description....:      ( ).    
+//									  SERIAL_PRIO,      
+// Argument.......:
+//      uint8_t PORT								=  (SERIAL_*)
+//      serialFunc FUNC							=  (NULL - )
+// ------------------------------------------------------------
+void serialOnIdle(uint8_t PORT, serialFunc FUNC) {
+	serial_rx[PORT].onIdle = FUNC;
+}
+
+// #SERIAL# ---------------------------------------------------
+// Description....:   DMA   
+// Argument.......:
+//      uint8_t PORT								=  (SERIAL_*)
+// ------------------------------------------------------------
+static __INLINE uint16_t serialHead(uint8_t PORT) {
+	//      ,       
+	return (uint16_t)((SERIAL_RX_SIZE - DMA_CHCNT(serial_hw[PORT].rxDma)) & (SERIAL_RX_SIZE - 1));
+}
+
+// #SERIAL# ---------------------------------------------------
+// Description....:       
+//									       SERIAL_RX_SIZE ,  
+// Argument.......:
+//      uint8_t PORT								=  (SERIAL_*)
+// ------------------------------------------------------------
+uint16_t serialAvailable(uint8_t PORT) {
+	if (serial_rx[PORT].open == RESET) return 0;
+	return (uint16_t)((serialHead(PORT) - serial_rx[PORT].tail) & (SERIAL_RX_SIZE - 1));
+}
+
+// #SERIAL# ---------------------------------------------------
+// Description....:      DMA (-1 -  )
+// Argument.......:
+//      uint8_t PORT								=  (SERIAL_*)
+// ------------------------------------------------------------
+int16_t serialRead(uint8_t PORT) {
+	serialRx *rx = &serial_rx[PORT];
+	uint8_t data;
+	if (rx->open == RESET || rx->tail == serialHead(PORT)) return -1;
+	data = rx->buf[rx->tail];
+	rx->tail = (rx->tail + 1) & (SERIAL_RX_SIZE - 1);
+	return data;
+}
+
+// #SERIAL# ---------------------------------------------------
+// Description....:  :    
+// Argument.......:
+//      uint8_t PORT								=  (SERIAL_*)
+// ------------------------------------------------------------
+static void serialIrq(uint8_t PORT) {
+	uint32_t usart = serial_hw[PORT].usart;
+	if (usart_interrupt_flag_get(usart, USART_INT_FLAG_IDLE) == RESET) return;
+	usart_interrupt_flag_clear(usart, USART_INT_FLAG_IDLE);
+	if (serial_rx[PORT].onIdle != NULL) serial_rx[PORT].onIdle();
+}
+
+void USART0_IRQHandler(void) {
+	serialIrq(SERIAL_LINK);
+}
+
+void USART1_IRQHandler(void) {
+	serialIrq(SERIAL_AUX);
+}
@@ -0,0 +1,92 @@
+// #INDEX# ======================================================================================================
+// Title .........:   USART:   DMA,     DMA
+// Arch ..........: GD32F130C8C6
+// Author ........: GreenBytes ( https://vk.com/greenbytes )
+// Version .......: 1.0.0.0
+// ==============================================================================================================
+
+#ifndef SERIAL_H
+
+	#define SERIAL_H
+
+	#include "gd32f1x0.h"
+	#include "../define.h"
+
+	// 
+	// 
+	//  : USART1, PIN_AUX_TX / PIN_AUX_RX, DMA CH3 () / CH4 ()
+	# define SERIAL_AUX										0
+	//  /: USART0, PIN_LINK_TX / PIN_LINK_RX, DMA CH1 () / CH2 ()
+	# define SERIAL_LINK									1
+	//  
+	# define SERIAL_PORTS									2
+	//  
+	//  :   TX  RX
+	# define SERIAL_MODE_FULL							0
+	//    :  TX (   ), RX  
+	# define SERIAL_MODE_HALF							1
+	//     ( , )
+	# define SERIAL_RX_SIZE								64
+	//    (   )
+	# define SERIAL_PRIO									3
+
+	// 
+	//      (   )
+	typedef void (*serialFunc)(void);
+
+	// #SERIAL# ---------------------------------------------------
+	// Description....:  : 8N1,   DMA,    DMA  
+	//									.         
+	//									      
+	// Argument.......:
+	//      uint8_t PORT								=  (SERIAL_*)
+	//      uint32_t BAUD								=  ()
+	//      uint8_t MODE								=  (SERIAL_MODE_*)
+	// ------------------------------------------------------------
+	void serialInit(uint8_t PORT, uint32_t BAUD, uint8_t MODE);
+
+	// #SERIAL# ---------------------------------------------------
+	// Description....:    DMA  .   ,  serialBusy() = SET
+	//									 ERROR,     
+	// Argument.......:
+	//      uint8_t PORT								=  (SERIAL_*)
+	//      const uint8_t *DATA					= 
+	//      uint16_t LEN								= 
+	// ------------------------------------------------------------
+	ErrStatus serialSend(uint8_t PORT, const uint8_t *DATA, uint16_t LEN);
+
+	// #SERIAL# ---------------------------------------------------
+	// Description....:    (DMA         )
+	// Argument.......:
+	//      uint8_t PORT								=  (SERIAL_*)
+	// ------------------------------------------------------------
+	FlagStatus serialBusy(uint8_t PORT);
+
+	// #SERIAL# ---------------------------------------------------
+	// Description....:      ( ).    
+	//									  SERIAL_PRIO,      
+	// Argument.......:
+	//      uint8_t PORT								=  (SERIAL_*)
+	//      serialFunc FUNC							=  (NULL - )
+	// ------------------------------------------------------------
+	void serialOnIdle(uint8_t PORT, serialFunc FUNC);
+
+	// #SERIAL# ---------------------------------------------------
+	// Description....:       
+	//									       SERIAL_RX_SIZE ,  
+	// Argument.......:
+	//      uint8_t PORT								=  (SERIAL_*)
+	// ------------------------------------------------------------
+	uint16_t serialAvailable(uint8_t PORT);
+
+	// #SERIAL# ---------------------------------------------------
+	// Description....:      DMA (-1 -  )
+	// Argument.......:
+	//      uint8_t PORT								=  (SERIAL_*)
+	// ------------------------------------------------------------
+	int16_t serialRead(uint8_t PORT);
+
+	//  
+	void USART0_IRQHandler(void);
+	void USART1_IRQHandler(void);
+#endif
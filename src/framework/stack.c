@@ -0,0 +1,43 @@
+// #INDEX# ======================================================================================================
+// Title .........:      (PSP)   (MSP)
+// Arch ..........: GD32F130C8C6
+// Author ........: GreenBytes ( https://vk.com/greenbytes )
+// Version .......: 1.0.0.0
+// ==============================================================================================================
+
+//  
+//      
+#include "gd32f1x0.h"
+//   
+#include "stack.h"
+//    
+#include "../define.h"
+
+//    startup_gd32f1x0.s (__initial_sp    microlib,
+//        )
+extern uint32_t Stack_Mem[];
+extern uint32_t __initial_psp[];
+extern uint32_t Stack_Isr_Mem[];
+extern uint32_t __initial_msp[];
+
+// #STACK# ----------------------------------------------------
+// Description....:       ()
+// Argument.......:
+//      uint8_t STACK								=  (STACK_MAIN / STACK_ISR)
+// ------------------------------------------------------------
+uint16_t stackHighWater(uint8_t STACK) {
+	const uint32_t *word = (STACK == STACK_ISR) ? Stack_Isr_Mem : Stack_Mem;
+	const uint32_t *top = (STACK == STACK_ISR) ? __initial_msp : __initial_psp;
+	while (word < top && *word == STACK_PAINT) word++;
+	return (uint16_t)((top - word) * 4);
+}
+
+// #STACK# ----------------------------------------------------
+// Description....:   ()
+// Argument.......:
+//      uint8_t STACK								=  (STACK_MAIN / STACK_ISR)
+// ------------------------------------------------------------
+uint16_t stackSize(uint8_t STACK) {
+	if (STACK == STACK_ISR) return (uint16_t)((__initial_msp - Stack_Isr_Mem) * 4);
+	return (uint16_t)((__initial_psp - Stack_Mem) * 4);
+}
@@ -0,0 +1,38 @@
+// #INDEX# ======================================================================================================
+// Title .........:      (PSP)   (MSP)
+// Arch ..........: GD32F130C8C6
+// Author ........: GreenBytes ( https://vk.com/greenbytes )
+// Version .......: 1.0.0.0
+// ==============================================================================================================
+
+#ifndef STACK_H
+
+	#define STACK_H
+
+	#include "gd32f1x0.h"
+	#include "../define.h"
+
+	// 
+	//  (   startup_gd32f1x0.s,  -  KickScooter.sct)
+	//   (thread mode, PSP)
+	# define STACK_MAIN										0
+	//  (handler mode, MSP)
+	# define STACK_ISR										1
+	//   :     Reset_Handler (startup_gd32f1x0.s,
+	// Stack_Paint),       
+	# define STACK_PAINT									0x5354434BU
+
+	// #STACK# ----------------------------------------------------
+	// Description....:       ()
+	// Argument.......:
+	//      uint8_t STACK								=  (STACK_MAIN / STACK_ISR)
+	// ------------------------------------------------------------
+	uint16_t stackHighWater(uint8_t STACK);
+
+	// #STACK# ----------------------------------------------------
+	// Description....:   ()
+	// Argument.......:
+	//      uint8_t STACK								=  (STACK_MAIN / STACK_ISR)
+	// ------------------------------------------------------------
+	uint16_t stackSize(uint8_t STACK);
+#endif
@@ -0,0 +1,279 @@
+// #INDEX# ======================================================================================================
+// Title .........:      - 
+// Arch ..........: GD32F130C8C6
+// Author ........: GreenBytes ( https://vk.com/greenbytes )
+// Version .......: 1.0.0.0
+// ==============================================================================================================
+
+//  
+//      
+#include "gd32f1x0.h"
+//  
+#include "storage.h"
+//    
+#include "../define.h"
+#include <string.h>
+
+//   - (FMC),  FMC    
+# define STORAGE_FMC										0x40022000U
+# define STORAGE_FMC_KEY								REG32(STORAGE_FMC + 0x04U)
+# define STORAGE_FMC_STAT								REG32(STORAGE_FMC + 0x0CU)
+# define STORAGE_FMC_CTL								REG32(STORAGE_FMC + 0x10U)
+# define STORAGE_FMC_ADDR								REG32(STORAGE_FMC + 0x14U)
+//  
+# define STORAGE_STAT_BUSY							BIT(0)
+# define STORAGE_STAT_PGERR							BIT(2)
+# define STORAGE_STAT_WPERR							BIT(4)
+# define STORAGE_STAT_ENDF							BIT(5)
+# define STORAGE_CTL_PG									BIT(0)
+# define STORAGE_CTL_PER								BIT(1)
+# define STORAGE_CTL_START							BIT(6)
+# define STORAGE_CTL_LK									BIT(7)
+//  
+# define STORAGE_KEY1										0x45670123U
+# define STORAGE_KEY2										0xCDEF89ABU
+//   ( )
+# define STORAGE_EMPTY									0xFF
+//    ( ,  -   )
+# define STORAGE_HEADER									0x7F
+
+//   (   -   )
+typedef struct {
+	uint8_t id;
+	uint8_t size;
+	uint16_t check;
+	uint8_t data[STORAGE_DATA_SIZE];
+} storageRecord;
+
+//    
+# define STORAGE_RECORDS								(STORAGE_PAGE_SIZE / sizeof(storageRecord))
+//     (0, 1)
+# define STORAGE_PAGE(N)								((const storageRecord *)(STORAGE_PAGE_ADDR + (N) * STORAGE_PAGE_SIZE))
+
+//   (NULL -   )   
+static const storageRecord *storage_page = NULL;
+static uint16_t storage_gen = 0;
+//     (-1 -    )
+static int16_t storage_free = -1;
+
+// #STORAGE# --------------------------------------------------
+// Description....:    (-16)
+// Argument.......:
+//      const storageRecord *REC		= 
+// ------------------------------------------------------------
+static uint16_t storageCheck(const storageRecord *REC) {
+	uint16_t sum1 = REC->id, sum2 = REC->id;
+	uint8_t i;
+	sum1 = (sum1 + REC->size) % 255;
+	sum2 = (sum2 + sum1) % 255;
+	for (i = 0; i < STORAGE_DATA_SIZE; i++) {
+		sum1 = (sum1 + REC->data[i]) % 255;
+		sum2 = (sum2 + sum1) % 255;
+	}
+	return (uint16_t)((sum2 << 8) | sum1);
+}
+
+// #STORAGE# --------------------------------------------------
+// Description....:    FMC
+// Argument.......: 
+// ------------------------------------------------------------
+static ErrStatus storageWait(void) {
+	uint32_t stat;
+	while (STORAGE_FMC_STAT & STORAGE_STAT_BUSY);
+	stat = STORAGE_FMC_STAT;
+	STORAGE_FMC_STAT = STORAGE_STAT_PGERR | STORAGE_STAT_WPERR | STORAGE_STAT_ENDF;
+	return (stat & (STORAGE_STAT_PGERR | STORAGE_STAT_WPERR)) ? ERROR : SUCCESS;
+}
+
+// #STORAGE# --------------------------------------------------
+// Description....:  /  FMC
+// Argument.......: 
+// ------------------------------------------------------------
+static void storageUnlock(void) {
+	if (STORAGE_FMC_CTL & STORAGE_CTL_LK) {
+		STORAGE_FMC_KEY = STORAGE_KEY1;
+		STORAGE_FMC_KEY = STORAGE_KEY2;
+	}
+}
+
+static void storageLock(void) {
+	STORAGE_FMC_CTL |= STORAGE_CTL_LK;
+}
+
+// #STORAGE# --------------------------------------------------
+// Description....:   
+// Argument.......:
+//      const storageRecord *PAGE		= 
+// ------------------------------------------------------------
+static ErrStatus storageErase(const storageRecord *PAGE) {
+	ErrStatus result;
+	STORAGE_FMC_CTL |= STORAGE_CTL_PER;
+	STORAGE_FMC_ADDR = (uint32_t)PAGE;
+	STORAGE_FMC_CTL |= STORAGE_CTL_START;
+	result = storageWait();
+	STORAGE_FMC_CTL &= ~STORAGE_CTL_PER;
+	return result;
+}
+
+// #STORAGE# --------------------------------------------------
+// Description....:    .    :  ,
+//									  ,    (0xFFFF),  
+//									-16     (   0xFF).    
+//									255     0xFF       
+// Argument.......:
+//      const storageRecord *PAGE		= 
+//      uint16_t INDEX							=    
+//      const storageRecord *REC		= 
+// ------------------------------------------------------------
+static ErrStatus storageProgram(const storageRecord *PAGE, uint16_t INDEX, const storageRecord *REC) {
+	volatile uint16_t *dst = (volatile uint16_t *)&PAGE[INDEX];
+	const uint16_t *src = (const uint16_t *)REC;
+	ErrStatus result = SUCCESS;
+	uint8_t i;
+	STORAGE_FMC_CTL |= STORAGE_CTL_PG;
+	//  0 - id  size ( ), 1 -   ( ),  
+	dst[0] = src[0];
+	result = storageWait();
+	for (i = 2; i < sizeof(storageRecord) / 2 && result == SUCCESS; i++) {
+		dst[i] = src[i];
+		result = storageWait();
+	}
+	if (result == SUCCESS) {
+		dst[1] = src[1];
+		result = storageWait();
+	}
+	STORAGE_FMC_CTL &= ~STORAGE_CTL_PG;
+	return result;
+}
+
+// #STORAGE# --------------------------------------------------
+// Description....:     (-1 -     )
+// Argument.......:
+//      const storageRecord *PAGE		= 
+// ------------------------------------------------------------
+static int32_t storageGeneration(const storageRecord *PAGE) {
+	if (PAGE[0].id != STORAGE_HEADER || PAGE[0].check != storageCheck(&PAGE[0])) return -1;
+	return PAGE[0].data[0] | (PAGE[0].data[1] << 8);
+}
+
+// #STORAGE# --------------------------------------------------
+// Description....:   :      
+//									    1 -     
+//									(   ),  0   -  
+// Argument.......: 
+// ------------------------------------------------------------
+static void storageSelect(void) {
+	int32_t gen0 = storageGeneration(STORAGE_PAGE(0));
+	int32_t gen1 = storageGeneration(STORAGE_PAGE(1));
+	if (gen0 >= 0 && (gen1 < 0 || (int16_t)(gen0 - gen1) > 0)) {
+		storage_page = STORAGE_PAGE(0);
+		storage_gen = (uint16_t)gen0;
+	} else {
+		storage_page = STORAGE_PAGE(1);
+		storage_gen = (gen1 >= 0) ? (uint16_t)gen1 : 0;
+	}
+}
+
+// #STORAGE# --------------------------------------------------
+// Description....:         
+//									     
+// Argument.......:
+//      uint8_t ID									=  
+// ------------------------------------------------------------
+static int16_t storageFind(uint8_t ID) {
+	int16_t found = -1;
+	uint16_t i;
+	if (storage_page == NULL) storageSelect();
+	for (i = 0; i < STORAGE_RECORDS; i++) {
+		if (storage_page[i].id == STORAGE_EMPTY) break;
+		if (storage_page[i].id == ID && storage_page[i].check == storageCheck(&storage_page[i])) found = i;
+	}
+	storage_free = i;
+	return found;
+}
+
+// #STORAGE# --------------------------------------------------
+// Description....:    
+// Argument.......:
+//      uint8_t ID									=   (. STORAGE_ID_*  define.h)
+//      void *DATA									=   
+//      uint8_t SIZE								=   (  STORAGE_DATA_SIZE)
+// ------------------------------------------------------------
+ErrStatus storageRead(uint8_t ID, void *DATA, uint8_t SIZE) {
+	int16_t index;
+	if (SIZE > STORAGE_DATA_SIZE) return ERROR;
+	index = storageFind(ID);
+	if (index < 0 || storage_page[index].size != SIZE) return ERROR;
+	memcpy(DATA, storage_page[index].data, SIZE);
+	return SUCCESS;
+}
+
+// #STORAGE# --------------------------------------------------
+// Description....:   (   ,    
+//									  ).         
+//									 :     !
+// Argument.......:
+//      uint8_t ID									=   (. STORAGE_ID_*  define.h)
+//      const void *DATA						= 
+//      uint8_t SIZE								=   (  STORAGE_DATA_SIZE)
+// ------------------------------------------------------------
+ErrStatus storageWrite(uint8_t ID, const void *DATA, uint8_t SIZE) {
+	storageRecord rec;
+	storageRecord keep[STORAGE_MAX_ID];
+	const storageRecord *next;
+	ErrStatus result = SUCCESS;
+	int16_t index;
+	uint8_t id;
+	if (ID == 0 || ID > STORAGE_MAX_ID || SIZE > STORAGE_DATA_SIZE) return ERROR;
+	memset(&rec, 0, sizeof(rec));
+	rec.id = ID;
+	rec.size = SIZE;
+	memcpy(rec.data, DATA, SIZE);
+	rec.check = storageCheck(&rec);
+	//      -   
+	index = storageFind(ID);
+	if (index >= 0 && memcmp(&storage_page[index], &rec, sizeof(rec)) == 0) return SUCCESS;
+	storageUnlock();
+	if (storage_free < (int16_t)STORAGE_RECORDS) {
+		result = storageProgram(storage_page, storage_free, &rec);
+		storage_free++;
+	} else {
+		//  :        ,
+		//      .      ,
+		//         .    :
+		//       
+		for (id = 1; id <= STORAGE_MAX_ID; id++) {
+			index = (id == ID) ? -1 : storageFind(id);
+			if (index >= 0) keep[id - 1] = storage_page[index];
+			else keep[id - 1].id = STORAGE_EMPTY;
+		}
+		keep[ID - 1] = rec;
+		next = (storage_page == STORAGE_PAGE(0)) ? STORAGE_PAGE(1) : STORAGE_PAGE(0);
+		result = storageErase(next);
+		index = 1;
+		for (id = 0; id < STORAGE_MAX_ID && result == SUCCESS; id++) {
+			if (keep[id].id == STORAGE_EMPTY) continue;
+			result = storageProgram(next, index++, &keep[id]);
+		}
+		if (result == SUCCESS) {
+			memset(&rec, 0, sizeof(rec));
+			rec.id = STORAGE_HEADER;
+			rec.size = 2;
+			rec.data[0] = (uint8_t)(storage_gen + 1);
+			rec.data[1] = (uint8_t)((storage_gen + 1) >> 8);
+			rec.check = storageCheck(&rec);
+			result = storageProgram(next, 0, &rec);
+		}
+		if (result == SUCCESS) {
+			storage_page = next;
+			storage_gen++;
+			storage_free = index;
+		} else {
+			//      
+			storage_page = NULL;
+			storage_free = -1;
+		}
+	}
+	storageLock();
+	return result;
+}
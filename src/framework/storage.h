@@ -0,0 +1,40 @@
+// #INDEX# ======================================================================================================
+// Title .........:      - 
+// Arch ..........: GD32F130C8C6
+// Author ........: GreenBytes ( https://vk.com/greenbytes )
+// Version .......: 1.0.0.0
+// ==============================================================================================================
+
+#ifndef STORAGE_H
+
+	#define STORAGE_H
+
+	#include "gd32f1x0.h"
+	#include "../define.h"
+
+	// 
+	//      ()
+	# define STORAGE_DATA_SIZE						12
+	//     (1..STORAGE_MAX_ID)
+	# define STORAGE_MAX_ID								8
+
+	// #STORAGE# --------------------------------------------------
+	// Description....:    
+	// Argument.......:
+	//      uint8_t ID									=   (. STORAGE_ID_*  define.h)
+	//      void *DATA									=   
+	//      uint8_t SIZE								=   (  STORAGE_DATA_SIZE)
+	// ------------------------------------------------------------
+	ErrStatus storageRead(uint8_t ID, void *DATA, uint8_t SIZE);
+
+	// #STORAGE# --------------------------------------------------
+	// Description....:   (   ,    
+	//									  ).         
+	//									 :     !
+	// Argument.......:
+	//      uint8_t ID									=   (. STORAGE_ID_*  define.h)
+	//      const void *DATA						= 
+	//      uint8_t SIZE								=   (  STORAGE_DATA_SIZE)
+	// ------------------------------------------------------------
+	ErrStatus storageWrite(uint8_t ID, const void *DATA, uint8_t SIZE);
+#endif
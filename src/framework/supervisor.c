@@ -0,0 +1,149 @@
+// #INDEX# ======================================================================================================
+// Title .........: :    ,   
+// Arch ..........: GD32F130C8C6
+// Author ........: GreenBytes ( https://vk.com/greenbytes )
+// Version .......: 1.0.0.0
+// ==============================================================================================================
+
+//  
+//      
+#include "gd32f1x0.h"
+//  
+#include "supervisor.h"
+//  
+#include "framework.h"
+//  
+#include "scheduler.h"
+//    
+#include "../define.h"
+
+//    
+# define SUP_MAGIC											0x53555046
+// WWDGT:      (     ~9 ),  ~0.9 
+# define SUP_WWDGT_COUNTER							0x7F
+# define SUP_WWDGT_WINDOW								0x75
+
+//  
+typedef struct {
+	const void *owner;
+	uint32_t timeout;
+	volatile uint32_t last;
+	volatile FlagStatus enable;
+} supClient;
+
+// 
+supClient sup_clients[SUP_MAX_CLIENTS];
+uint8_t sup_count = 0;
+//   :  (  )    
+NOINIT supFault sup_fault;
+supFault sup_lastFault;
+FlagStatus sup_hasLastFault = RESET;
+//    
+uint8_t sup_tick = 0;
+
+// #SUPERVISOR# -----------------------------------------------
+// Description....:     
+// Argument.......:
+//      const supFault *FAULT				= 
+// ------------------------------------------------------------
+static uint32_t supCheck(const supFault *FAULT) {
+	return ~(FAULT->magic ^ (uint32_t)FAULT->id ^ FAULT->owner ^ FAULT->time ^ FAULT->last);
+}
+
+// #SUPERVISOR# -----------------------------------------------
+// Description....: :       ,  WWDGT (SUP_WWDGT)
+// Argument.......: 
+// ------------------------------------------------------------
+void supInit(void) {
+	if (sup_fault.magic == SUP_MAGIC && sup_fault.check == supCheck(&sup_fault)) {
+		sup_lastFault = sup_fault;
+		sup_hasLastFault = SET;
+	}
+	sup_fault.magic = 0;
+	#if SUP_WWDGT
+		rcu_periph_clock_enable(RCU_WWDGT);
+		wwdgt_config(SUP_WWDGT_COUNTER, SUP_WWDGT_WINDOW, WWDGT_CFG_PSC_DIV8);
+		wwdgt_enable();
+	#endif
+}
+
+// #SUPERVISOR# -----------------------------------------------
+// Description....:  ,   (-1 -  )
+// Argument.......:
+//      const void *OWNER						=  (   )
+//      uint32_t TIMEOUT						=     ()
+// ------------------------------------------------------------
+int8_t supRegister(const void *OWNER, uint32_t TIMEOUT) {
+	supClient *client;
+	if (sup_count >= SUP_MAX_CLIENTS) return -1;
+	client = &sup_clients[sup_count];
+	client->owner = OWNER;
+	client->timeout = TIMEOUT;
+	client->last = millis();
+	client->enable = SET;
+	return (int8_t)sup_count++;
+}
+
+// #SUPERVISOR# -----------------------------------------------
+// Description....:   (  )
+// Argument.......:
+//      int8_t ID										=  
+// ------------------------------------------------------------
+RAMFUNC void supCheckIn(int8_t ID) {
+	if (ID >= 0 && ID < sup_count) sup_clients[ID].last = millis();
+}
+
+// #SUPERVISOR# -----------------------------------------------
+// Description....:  /     (    )
+// Argument.......:
+//      int8_t ID										=  
+//      FlagStatus ENABLE						= SET - 
+// ------------------------------------------------------------
+void supEnable(int8_t ID, FlagStatus ENABLE) {
+	if (ID < 0 || ID >= sup_count) return;
+	sup_clients[ID].last = millis();
+	sup_clients[ID].enable = ENABLE;
+}
+
+// #SUPERVISOR# -----------------------------------------------
+// Description....:     FWDGT / WWDGT,    .
+//									     ,   .
+//									  SysTick_Handler
+// Argument.......: 
+// ------------------------------------------------------------
+void supTick(void) {
+	uint32_t now;
+	int8_t running;
+	uint8_t i;
+	if (++sup_tick < SUP_PERIOD_MS) return;
+	sup_tick = 0;
+	//    -   ,  
+	if (sup_fault.magic == SUP_MAGIC) return;
+	now = millis();
+	for (i = 0; i < sup_count; i++) {
+		if (sup_clients[i].enable == RESET || now - sup_clients[i].last <= sup_clients[i].timeout) continue;
+		//  :     ,  
+		//   ,     -    
+		running = schedCurrent();
+		if (running >= 0 && running < sup_count) i = (uint8_t)running;
+		sup_fault.id = i;
+		sup_fault.owner = (uint32_t)sup_clients[i].owner;
+		sup_fault.time = now;
+		sup_fault.last = sup_clients[i].last;
+		sup_fault.magic = SUP_MAGIC;
+		sup_fault.check = supCheck(&sup_fault);
+		return;
+	}
+	fwdgt_counter_reload();
+	#if SUP_WWDGT
+		wwdgt_counter_update(SUP_WWDGT_COUNTER);
+	#endif
+}
+
+// #SUPERVISOR# -----------------------------------------------
+// Description....: , -     (NULL -   )
+// Argument.......: 
+// ------------------------------------------------------------
+const supFault *supLastFault(void) {
+	return (sup_hasLastFault == SET) ? &sup_lastFault : NULL;
+}
@@ -0,0 +1,74 @@
+// #INDEX# ======================================================================================================
+// Title .........: :    ,   
+// Arch ..........: GD32F130C8C6
+// Author ........: GreenBytes ( https://vk.com/greenbytes )
+// Version .......: 1.0.0.0
+// ==============================================================================================================
+
+#ifndef SUPERVISOR_H
+
+	#define SUPERVISOR_H
+
+	#include "gd32f1x0.h"
+	#include "../define.h"
+
+	// 
+	//    :   (SCHED_MAX_TASKS),
+	//    
+	# define SUP_MAX_CLIENTS						14
+
+	//   ,   (  )
+	typedef struct {
+		uint32_t magic;
+		//      (     -   .map)
+		int32_t id;
+		uint32_t owner;
+		//   (  )    
+		uint32_t time;
+		uint32_t last;
+		uint32_t check;
+	} supFault;
+
+	// #SUPERVISOR# -----------------------------------------------
+	// Description....: :       ,  WWDGT (SUP_WWDGT)
+	// Argument.......: 
+	// ------------------------------------------------------------
+	void supInit(void);
+
+	// #SUPERVISOR# -----------------------------------------------
+	// Description....:  ,   (-1 -  )
+	// Argument.......:
+	//      const void *OWNER						=  (   )
+	//      uint32_t TIMEOUT						=     ()
+	// ------------------------------------------------------------
+	int8_t supRegister(const void *OWNER, uint32_t TIMEOUT);
+
+	// #SUPERVISOR# -----------------------------------------------
+	// Description....:   (  )
+	// Argument.......:
+	//      int8_t ID										=  
+	// ------------------------------------------------------------
+	void supCheckIn(int8_t ID);
+
+	// #SUPERVISOR# -----------------------------------------------
+	// Description....:  /     (    )
+	// Argument.......:
+	//      int8_t ID										=  
+	//      FlagStatus ENABLE						= SET - 
+	// ------------------------------------------------------------
+	void supEnable(int8_t ID, FlagStatus ENABLE);
+
+	// #SUPERVISOR# -----------------------------------------------
+	// Description....:     FWDGT / WWDGT,    .
+	//									     ,   .
+	//									  SysTick_Handler
+	// Argument.......: 
+	// ------------------------------------------------------------
+	void supTick(void);
+
+	// #SUPERVISOR# -----------------------------------------------
+	// Description....: , -     (NULL -   )
+	// Argument.......: 
+	// ------------------------------------------------------------
+	const supFault *supLastFault(void);
+#endif
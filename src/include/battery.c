@@ -0,0 +1,290 @@
+// #INDEX# ======================================================================================================
+// Title .........:   
+// Arch ..........: GD32F130C8C6
+// Author ........: GreenBytes ( https://vk.com/greenbytes )
+// Version .......: 1.0.0.0
+// ==============================================================================================================
+
+//  
+//      
+#include "gd32f1x0.h"
+//   
+#include "battery.h"
+//     
+#include "bldc.h"
+//  
+#include "../framework/framework.h"
+#include "../framework/storage.h"
+//    
+#include "../define.h"
+
+// ,  0.01% (*)
+# define BATTERY_MAS_PER_STEP						((int32_t)BATTERY_CAPACITY_MAH * 36 / 100)
+//   (0.01%)
+# define BATTERY_SOC_FULL								10000
+//   
+# define BATTERY_FILTER_SHIFT						2
+// RLS: 1/lambda,     (1/^2, Q16)
+# define BATTERY_RLS_INV_LAMBDA					FIX_Q16(1.0 / BATTERY_RLS_LAMBDA)
+# define BATTERY_RLS_P_INIT							FIX_Q16(1.0)
+# define BATTERY_RLS_P_MIN							FIX_Q16(0.0005)
+# define BATTERY_RLS_P_MAX							FIX_Q16(4.0)
+
+//    
+typedef struct {
+	uint16_t soc;
+	uint16_t rint;
+} batteryRecord;
+
+//     Li-ion ()   10% 
+const uint16_t battery_ocvTable[11] =
+		{
+			3300, 3500, 3600, 3660, 3710, 3760, 3820, 3890, 3970, 4060, 4150
+		};
+
+//      ()
+uint32_t battery_voltReg;
+uint16_t battery_voltage = 0;
+//      ()
+int32_t battery_currReg;
+int32_t battery_current = 0;
+//    ( )
+int32_t battery_currOffset = 0;
+//    ()
+uint16_t battery_ocv = 0;
+//   ()
+uint16_t battery_rint = BATTERY_RINT_MOHM;
+// RLS:   (, Q16)   (1/^2, Q16)
+q16_t battery_rlsR = FIX_Q16(BATTERY_RINT_MOHM);
+q16_t battery_rlsP = BATTERY_RLS_P_INIT;
+//     RLS
+uint16_t battery_lastVolt = 0;
+int32_t battery_lastCurr = 0;
+//     ()
+int32_t battery_currLimit = BATTERY_MAX_MA;
+//   (*)    (*)
+int32_t battery_used = 0;
+int32_t battery_rem = 0;
+//   (0.01%)      
+uint16_t battery_soc = 0;
+uint16_t battery_savedSoc = 0;
+//       ()
+uint32_t battery_lastTick = 0;
+uint32_t battery_restSince = 0;
+FlagStatus battery_rest = RESET;
+
+// #BATTERY# ---------------------------------------------------
+// Description....:       
+// Argument.......:
+//      uint16_t cellMv							=   ()
+// ------------------------------------------------------------
+static uint16_t batteryOcvToSoc(uint16_t cellMv) {
+	uint8_t i;
+	if (cellMv <= battery_ocvTable[0]) return 0;
+	if (cellMv >= battery_ocvTable[10]) return BATTERY_SOC_FULL;
+	for (i = 0; cellMv >= battery_ocvTable[i + 1]; i++);
+	return (uint16_t)(i * 1000 + (uint32_t)(cellMv - battery_ocvTable[i]) * 1000 / (battery_ocvTable[i + 1] - battery_ocvTable[i]));
+}
+
+// #BATTERY# ---------------------------------------------------
+// Description....:      : dV = -R * dI
+//									      ( )
+// Argument.......:
+//      uint16_t volt								=  ()
+//      int32_t curr								=  ()
+// ------------------------------------------------------------
+static void batteryRls(uint16_t volt, int32_t curr) {
+	q16_t x, y, px, den, e;
+	int32_t step = curr - battery_lastCurr;
+	if (ABS(step) >= BATTERY_RLS_MIN_STEP_MA) {
+		//  -   (),  -  ()
+		x = (q16_t)(((int64_t)step << 16) / 1000);
+		y = (q16_t)(((int32_t)battery_lastVolt - (int32_t)volt) << 16);
+		e = y - fixMul(battery_rlsR, x);
+		px = fixMul(battery_rlsP, x);
+		den = FIX_Q16_ONE + fixMul(px, x);
+		// R += P*x*e / (1 + x*P*x); P = (P - (P*x)^2 / (1 + x*P*x)) / lambda
+		battery_rlsR += (q16_t)(((int64_t)px * e) / den);
+		battery_rlsP -= (q16_t)(((int64_t)px * px) / den);
+		battery_rlsP = CLAMP(fixMul(battery_rlsP, BATTERY_RLS_INV_LAMBDA), BATTERY_RLS_P_MIN, BATTERY_RLS_P_MAX);
+		battery_rlsR = CLAMP(battery_rlsR, FIX_Q16(BATTERY_RINT_MIN_MOHM), FIX_Q16(BATTERY_RINT_MAX_MOHM));
+		battery_rint = (uint16_t)(battery_rlsR >> 16);
+	}
+	battery_lastVolt = volt;
+	battery_lastCurr = curr;
+}
+
+// #BATTERY# ---------------------------------------------------
+// Description....:   ()   ()
+// Argument.......:
+//      uint16_t *volt							=  
+//      int32_t *curr								=  
+// ------------------------------------------------------------
+static void batterySample(uint16_t *volt, int32_t *curr) {
+	*volt = (uint16_t)analogReadScaled(PIN_VBAT, CONST_BATTERY_MV_Q16);
+	*curr = fixMulSat((int32_t)analogReadComp(PIN_CURRENT_DC) - battery_currOffset, CONST_MOTOR_MA_Q16);
+}
+
+// #BATTERY# ---------------------------------------------------
+// Description....:       ( )
+//									,     , 
+// Argument.......: 
+// ------------------------------------------------------------
+static void batteryRestore(void) {
+	batteryRecord rec;
+	uint16_t socOcv;
+	if (storageRead(STORAGE_ID_BATTERY, &rec, sizeof(rec)) != SUCCESS) return;
+	socOcv = batteryOcvToSoc(battery_ocv / BATTERY_CELLS);
+	//   ,       
+	if (ABS((int32_t)rec.soc - (int32_t)socOcv) < 2000) {
+		battery_used += ((int32_t)battery_soc - (int32_t)rec.soc) * BATTERY_MAS_PER_STEP;
+		battery_soc = rec.soc;
+		battery_savedSoc = battery_soc;
+	}
+	//     -    RLS
+	if (rec.rint >= BATTERY_RINT_MIN_MOHM && rec.rint <= BATTERY_RINT_MAX_MOHM) {
+		battery_rint = rec.rint;
+		battery_rlsR = (q16_t)battery_rint << 16;
+		battery_rlsP = BATTERY_RLS_P_INIT;
+	}
+}
+
+// #BATTERY# ---------------------------------------------------
+// Description....: :    ,    
+//									  (     ).   fw_init()   
+// Argument.......: 
+// ------------------------------------------------------------
+void batteryInit(void) {
+	uint16_t socOcv;
+	uint8_t i;
+	battery_currOffset = 0;
+	for (i = 0; i < 16; i++) battery_currOffset += analogReadComp(PIN_CURRENT_DC);
+	battery_currOffset >>= 4;
+	batterySample(&battery_voltage, &battery_current);
+	battery_voltReg = (uint32_t)battery_voltage << BATTERY_FILTER_SHIFT;
+	battery_currReg = 0;
+	battery_current = 0;
+	battery_ocv = battery_voltage;
+	socOcv = batteryOcvToSoc(battery_ocv / BATTERY_CELLS);
+	battery_soc = socOcv;
+	battery_rlsR = (q16_t)battery_rint << 16;
+	battery_rlsP = BATTERY_RLS_P_INIT;
+	battery_lastVolt = battery_voltage;
+	battery_lastCurr = battery_current;
+	battery_used = (int32_t)(BATTERY_SOC_FULL - battery_soc) * BATTERY_MAS_PER_STEP;
+	battery_rem = 0;
+	battery_savedSoc = battery_soc;
+	battery_lastTick = millis();
+	battery_rest = RESET;
+	//       :      
+	bootDefer(batteryRestore);
+}
+
+// #BATTERY# ---------------------------------------------------
+// Description....:    ,   ( )  
+//									   .   BATTERY_TASK_MS
+// Argument.......: 
+// ------------------------------------------------------------
+void batteryTask(void) {
+	uint16_t volt;
+	int32_t curr;
+	int32_t target;
+	uint32_t now = millis();
+	uint32_t dt = now - battery_lastTick;
+	battery_lastTick = now;
+	batterySample(&volt, &curr);
+	batteryRls(volt, curr);
+	battery_voltReg = battery_voltReg - (battery_voltReg >> BATTERY_FILTER_SHIFT) + volt;
+	battery_voltage = battery_voltReg >> BATTERY_FILTER_SHIFT;
+	battery_currReg = battery_currReg - (battery_currReg >> BATTERY_FILTER_SHIFT) + curr;
+	battery_current = battery_currReg >> BATTERY_FILTER_SHIFT;
+	//     
+	battery_rem += curr * (int32_t)dt;
+	battery_used += battery_rem / 1000;
+	battery_rem %= 1000;
+	battery_used = CLAMP(battery_used, 0, BATTERY_SOC_FULL * BATTERY_MAS_PER_STEP);
+	//   :      
+	battery_ocv = (uint16_t)(battery_voltage + battery_current * battery_rint / 1000);
+	// ,       
+	battery_currLimit = ((int32_t)battery_ocv - BATTERY_CUTOFF_MV) * 1000 / battery_rint;
+	battery_currLimit = CLAMP(battery_currLimit, 0, BATTERY_MAX_MA);
+	//        
+	if (ABS(battery_current) < BATTERY_REST_MA) {
+		if (battery_rest == RESET) {
+			battery_rest = SET;
+			battery_restSince = now;
+		} else if (now - battery_restSince >= BATTERY_REST_MS) {
+			target = (int32_t)(BATTERY_SOC_FULL - batteryOcvToSoc(battery_ocv / BATTERY_CELLS)) * BATTERY_MAS_PER_STEP;
+			battery_used += (target - battery_used) >> BATTERY_OCV_SHIFT;
+		}
+	} else {
+		battery_rest = RESET;
+	}
+	battery_soc = (uint16_t)(BATTERY_SOC_FULL - battery_used / BATTERY_MAS_PER_STEP);
+	if (engineEnabled() == RESET && ABS((int32_t)battery_soc - (int32_t)battery_savedSoc) >= BATTERY_SAVE_DELTA) {
+		batterySave();
+	}
+}
+
+// #BATTERY# ---------------------------------------------------
+// Description....:     (   )
+// Argument.......: 
+// ------------------------------------------------------------
+ErrStatus batterySave(void) {
+	batteryRecord rec;
+	if (engineEnabled() == SET) return ERROR;
+	rec.soc = battery_soc;
+	rec.rint = battery_rint;
+	if (storageWrite(STORAGE_ID_BATTERY, &rec, sizeof(rec)) == ERROR) return ERROR;
+	battery_savedSoc = battery_soc;
+	return SUCCESS;
+}
+
+// #BATTERY# ---------------------------------------------------
+// Description....:   (0.01%,  0  10000)
+// Argument.......: 
+// ------------------------------------------------------------
+uint16_t batterySoc(void) {
+	return battery_soc;
+}
+
+// #BATTERY# ---------------------------------------------------
+// Description....:     ()
+// Argument.......: 
+// ------------------------------------------------------------
+uint16_t batteryVoltage(void) {
+	return battery_voltage;
+}
+
+// #BATTERY# ---------------------------------------------------
+// Description....:           ()
+// Argument.......: 
+// ------------------------------------------------------------
+uint16_t batteryOcv(void) {
+	return battery_ocv;
+}
+
+// #BATTERY# ---------------------------------------------------
+// Description....:   (,   )
+// Argument.......: 
+// ------------------------------------------------------------
+int32_t batteryCurrent(void) {
+	return battery_current;
+}
+
+// #BATTERY# ---------------------------------------------------
+// Description....:     ()
+// Argument.......: 
+// ------------------------------------------------------------
+uint16_t batteryResistance(void) {
+	return battery_rint;
+}
+
+// #BATTERY# ---------------------------------------------------
+// Description....:   (),     
+//									    BMS (BATTERY_CUTOFF_MV)
+// Argument.......: 
+// ------------------------------------------------------------
+int32_t batteryCurrentLimit(void) {
+	return battery_currLimit;
+}
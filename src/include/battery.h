@@ -0,0 +1,77 @@
+// #INDEX# ======================================================================================================
+// Title .........:   
+// Arch ..........: GD32F130C8C6
+// Author ........: GreenBytes ( https://vk.com/greenbytes )
+// Version .......: 1.0.0.0
+// ==============================================================================================================
+
+#ifndef BATTERY_H
+
+	#define BATTERY_H
+
+	//  
+	//      
+	#include "gd32f1x0.h"
+
+	//  
+	#include "../framework/framework.h"
+	//    
+	#include "../define.h"
+
+	// #BATTERY# ---------------------------------------------------
+	// Description....: :    ,    
+	//									  (     ).   fw_init()   
+	// Argument.......: 
+	// ------------------------------------------------------------
+	void batteryInit(void);
+
+	// #BATTERY# ---------------------------------------------------
+	// Description....:    ,   ( )  
+	//									   .   BATTERY_TASK_MS
+	// Argument.......: 
+	// ------------------------------------------------------------
+	void batteryTask(void);
+
+	// #BATTERY# ---------------------------------------------------
+	// Description....:     (   )
+	// Argument.......: 
+	// ------------------------------------------------------------
+	ErrStatus batterySave(void);
+
+	// #BATTERY# ---------------------------------------------------
+	// Description....:   (0.01%,  0  10000)
+	// Argument.......: 
+	// ------------------------------------------------------------
+	uint16_t batterySoc(void);
+
+	// #BATTERY# ---------------------------------------------------
+	// Description....:     ()
+	// Argument.......: 
+	// ------------------------------------------------------------
+	uint16_t batteryVoltage(void);
+
+	// #BATTERY# ---------------------------------------------------
+	// Description....:           ()
+	// Argument.......: 
+	// ------------------------------------------------------------
+	uint16_t batteryOcv(void);
+
+	// #BATTERY# ---------------------------------------------------
+	// Description....:   (,   )
+	// Argument.......: 
+	// ------------------------------------------------------------
+	int32_t batteryCurrent(void);
+
+	// #BATTERY# ---------------------------------------------------
+	// Description....:     ()
+	// Argument.......: 
+	// ------------------------------------------------------------
+	uint16_t batteryResistance(void);
+
+	// #BATTERY# ---------------------------------------------------
+	// Description....:   (),     
+	//									    BMS (BATTERY_CUTOFF_MV)
+	// Argument.......: 
+	// ------------------------------------------------------------
+	int32_t batteryCurrentLimit(void);
+#endif
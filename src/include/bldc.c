@@ -12,22 +12,30 @@
 #include "bldc.h"
 //  
 #include "../framework/framework.h"
+#include "../framework/multirate.h"
+#include "../framework/seqlock.h"
+#include "../framework/supervisor.h"
 //    
 #include "../define.h"
 
+//    TIMER0 (CH0CV, CH1CV, CH2CV  ):    SPL
+# define BLDC_CHCV(CH)									REG32(TIMER_BLDC + 0x34U + ((uint32_t)(CH) << 2))
+FIX_STATIC_ASSERT(TIMER_CH_0 == 0 && TIMER_CH_1 == 1 && TIMER_CH_2 == 2, bldc_chcv);
+
 //    
 const int16_t pwm_res = 72000000 / 2 / PWM_FREQ; // = 2000
 //  
 int16_t bldc_inputFilterPwm = 0;
+//  
+int16_t bldc_limitPwm = 1000;
 // / 
 FlagStatus bldc_enable = RESET;
-//  
-//  
-uint8_t hall_a;
-//  
-uint8_t hall_b;
-//  
-uint8_t hall_c;
+//     :  0 - ,  1 - ,  2 - 
+const pinGroup bldc_hallGroup =
+		{
+			PIN_GROUP_PORT(PIN_HALL_A) | PIN_GROUP_PORT(PIN_HALL_B) | PIN_GROUP_PORT(PIN_HALL_C), 3,
+			{ PIN_STEP(PIN_HALL_A, 0), PIN_STEP(PIN_HALL_B, 1), PIN_STEP(PIN_HALL_C, 2) }
+		};
 //  
 uint8_t hall;
 //  
@@ -42,6 +50,21 @@ int32_t filter_reg;
 uint32_t speedcount = 0;
 //    
 uint32_t speedtick = 0;
+//  (. /)
+uint32_t bldc_speed = 0;
+//         
+uint16_t bldc_hallBad = 0;
+FlagStatus bldc_hallFault = RESET;
+//      :   
+uint32_t bldc_cyclesLast = 0;
+uint32_t bldc_cyclesMax = 0;
+//     
+int8_t bldc_supId = -1;
+//      
+bldcState bldc_state;
+seqLock bldc_stateLock = { 0 };
+//  :   ,   
+EVENT_QUEUE_DEFINE(bldc_events, BLDC_EVENT_COUNT);
 
 //   
 const uint8_t hall_to_pos[8] =
@@ -65,7 +88,7 @@ const uint8_t hall_to_pos[8] =
 //      int *b       								=   B
 //      int *g       	 							=   G
 // ------------------------------------------------------------
-__INLINE void enginePOV(int pwm, uint32_t pwmPos, int *y, int *b, int *g) {
+RAMFUNC __INLINE void enginePOV(int pwm, uint32_t pwmPos, int *y, int *b, int *g) {
   switch(pwmPos) {
     case 1:
       *y = 0;
@@ -104,6 +127,90 @@ __INLINE void enginePOV(int pwm, uint32_t pwmPos, int *y, int *b, int *g) {
   }
 }
 
+// #BLDC# ------------------------------------------------------
+// Description....:     ( enginePWM;   TIMER0 -  engineMode)
+// Argument.......: 
+// ------------------------------------------------------------
+static RAMFUNC void enginePublish(void) {
+	seqWriteBegin(&bldc_stateLock);
+	bldc_state.enable = bldc_enable;
+	bldc_state.hall = hall;
+	bldc_state.pos = pos;
+	bldc_state.setpoint = bldc_inputFilterPwm;
+	bldc_state.limit = bldc_limitPwm;
+	bldc_state.duty = bldc_outputFilterPwm;
+	bldc_state.period = speedcount;
+	bldc_state.speed = bldc_speed;
+	seqWriteEnd(&bldc_stateLock);
+}
+
+// #BLDC# ------------------------------------------------------
+// Description....: :  , TIMER0    
+//									(  16      WFI)
+// Argument.......: 
+// ------------------------------------------------------------
+static void enginePark(void) {
+	bldc_enable = RESET;
+	timer_interrupt_disable(TIMER_BLDC, TIMER_INT_UP);
+	timer_disable(TIMER_BLDC);
+	timer_automatic_output_disable(TIMER_BLDC);
+	timer_channel_output_pulse_value_config(TIMER_BLDC, TIMER_BLDC_G, 0);
+	timer_channel_output_pulse_value_config(TIMER_BLDC, TIMER_BLDC_B, 0);
+	timer_channel_output_pulse_value_config(TIMER_BLDC, TIMER_BLDC_Y, 0);
+	bldc_speed = 0;
+	speedtick = 0;
+	supEnable(bldc_supId, RESET);
+	enginePublish();
+}
+
+// #BLDC# ------------------------------------------------------
+// Description....:   : TIMER0 ,     1/PWM_FREQ
+// Argument.......: 
+// ------------------------------------------------------------
+static void engineUnpark(void) {
+	bldc_hallBad = 0;
+	bldc_hallFault = RESET;
+	timer_interrupt_flag_clear(TIMER_BLDC, TIMER_INT_FLAG_UP);
+	timer_interrupt_enable(TIMER_BLDC, TIMER_INT_UP);
+	timer_enable(TIMER_BLDC);
+	supEnable(bldc_supId, SET);
+	bldc_enable = SET;
+}
+
+// #BLDC# ------------------------------------------------------
+// Description....:    (MR_SPEED_HZ):    
+// Argument.......: 
+// ------------------------------------------------------------
+static void engineSpeedSlice(void) {
+	uint32_t count = speedcount;
+	if (speedtick > (uint32_t)PWM_FREQ * BLDC_SPEED_TIMEOUT_MS / 1000 || count == 0) bldc_speed = 0;
+	else bldc_speed = (uint32_t)PWM_FREQ * 60 / count;
+}
+
+// #BLDC# ------------------------------------------------------
+// Description....:   (MR_SUPER_HZ):   
+// Argument.......: 
+// ------------------------------------------------------------
+static void engineSuperSlice(void) {
+	if (bldc_hallFault == RESET && bldc_hallBad >= (uint32_t)PWM_FREQ * BLDC_HALL_FAULT_MS / 1000) {
+		bldc_hallFault = SET;
+		eventPost(&bldc_events, EVENT_HALL_FAULT, 0, hall, millis());
+	}
+}
+
+// #BLDC# ------------------------------------------------------
+// Description....: :      
+//									  ,   .   fw_init()
+// Argument.......: 
+// ------------------------------------------------------------
+void engineInit(void) {
+	mrAttach(MR_SLICE_SPEED, engineSpeedSlice);
+	mrAttach(MR_SLICE_SUPER, engineSuperSlice);
+	bldc_supId = supRegister((const void *)enginePWM, BLDC_SUP_MS);
+	enginePark();
+	bootMark(BOOT_MOTOR);
+}
+
 // #BLDC# ------------------------------------------------------
 // Description....:   
 // Argument.......: 
@@ -117,7 +224,17 @@ __INLINE void enginePOV(int pwm, uint32_t pwmPos, int *y, int *b, int *g) {
 //		*            
 // ------------------------------------------------------------
 void engineMode(FlagStatus setMode) {
-	bldc_enable = setMode;
+	if (setMode == bldc_enable) return;
+	if (setMode == SET) engineUnpark();
+	else enginePark();
+}
+
+// #BLDC# ------------------------------------------------------
+// Description....:    (SET - )
+// Argument.......: 
+// ------------------------------------------------------------
+FlagStatus engineEnabled(void) {
+	return bldc_enable;
 }
 
 // #BLDC# ------------------------------------------------------
@@ -129,36 +246,118 @@ void engineWrite(int16_t setPwm) {
 	bldc_inputFilterPwm = CLAMP(setPwm, -1000, 1000);
 }
 
+// #BLDC# ------------------------------------------------------
+// Description....:   (    )
+// Argument.......: 
+//      uint16_t setLimit						=     0  1000
+// ------------------------------------------------------------
+void engineLimit(uint16_t setLimit) {
+	bldc_limitPwm = MAX(setLimit, 1000);
+}
+
+// #BLDC# ------------------------------------------------------
+// Description....:     
+// Argument.......: 
+// ------------------------------------------------------------
+int16_t engineDuty(void) {
+	return bldc_outputFilterPwm;
+}
+
+// #BLDC# ------------------------------------------------------
+// Description....:   (   )
+// Argument.......: 
+// ------------------------------------------------------------
+uint32_t engineSpeed(void) {
+	return bldc_speed;
+}
+
+// #BLDC# ------------------------------------------------------
+// Description....:    (   )
+// Argument.......: 
+// ------------------------------------------------------------
+FlagStatus engineHallFault(void) {
+	return bldc_hallFault;
+}
+
+// #BLDC# ------------------------------------------------------
+// Description....:        
+//									(    ,   )
+// Argument.......: 
+//      bldcState *STATE						=  
+// ------------------------------------------------------------
+void engineSnapshot(bldcState *STATE) {
+	seqSnapshot(&bldc_stateLock, STATE, &bldc_state, sizeof(bldcState));
+}
+
+// #BLDC# ------------------------------------------------------
+// Description....:    (EVENT_*  define.h), ERROR -  
+//									  -  
+// Argument.......: 
+//      event *EVT									=   
+// ------------------------------------------------------------
+ErrStatus engineEvent(event *EVT) {
+	return eventGet(&bldc_events, EVT);
+}
+
+// #BLDC# ------------------------------------------------------
+// Description....:        ( )
+//									        (RAMFUNC_ENABLE)
+// Argument.......: 
+// ------------------------------------------------------------
+uint32_t engineCycles(void) {
+	return bldc_cyclesMax;
+}
+
+// #BLDC# ------------------------------------------------------
+// Description....:    
+// Argument.......: 
+//      uint32_t start							=  DWT->CYCCNT  
+// ------------------------------------------------------------
+static RAMFUNC void engineCyclesUpdate(uint32_t start) {
+	bldc_cyclesLast = DWT->CYCCNT - start;
+	if (bldc_cyclesLast > bldc_cyclesMax) bldc_cyclesMax = bldc_cyclesLast;
+}
+
 // #BLDC# ------------------------------------------------------
 // Description....:       
 // Argument.......: 
 // ------------------------------------------------------------
-void enginePWM(void) {
+RAMFUNC void enginePWM(void) {
 	int y = 0, b = 0, g = 0;
+	uint32_t start = DWT->CYCCNT;
+	//   -  ,      PendSV / 
+	mrTick();
+	supCheckIn(bldc_supId);
 	if (bldc_enable == RESET) {
-		timer_automatic_output_disable(TIMER_BLDC);
-		timer_channel_output_pulse_value_config(TIMER_BLDC, TIMER_BLDC_G, 0);
-		timer_channel_output_pulse_value_config(TIMER_BLDC, TIMER_BLDC_B, 0);
-		timer_channel_output_pulse_value_config(TIMER_BLDC, TIMER_BLDC_Y, 0);
+		TIMER_CCHP(TIMER_BLDC) &= ~TIMER_CCHP_OAEN;
+		BLDC_CHCV(TIMER_BLDC_G) = 0;
+		BLDC_CHCV(TIMER_BLDC_B) = 0;
+		BLDC_CHCV(TIMER_BLDC_Y) = 0;
+		enginePublish();
+		engineCyclesUpdate(start);
 		return;
   } else {
-		timer_automatic_output_enable(TIMER_BLDC);
+		TIMER_CCHP(TIMER_BLDC) |= TIMER_CCHP_OAEN;
   }
-	hall_a = gpio_input_bit_get(getPort(PIN_HALL_A), getPin(PIN_HALL_A));
-  hall_b = gpio_input_bit_get(getPort(PIN_HALL_B), getPin(PIN_HALL_B));
-	hall_c = gpio_input_bit_get(getPort(PIN_HALL_C), getPin(PIN_HALL_C));
-  hall = hall_a * 1 + hall_b * 2 + hall_c * 4;
+	hall = (uint8_t)pinGroupRead(&bldc_hallGroup);
   pos = hall_to_pos[hall];
-	filter_reg = filter_reg - (filter_reg >> FILTER_SHIFT) + bldc_inputFilterPwm;
+	if (pos == 0) {
+		if (bldc_hallBad < 0xFFFF) bldc_hallBad++;
+	} else {
+		bldc_hallBad = 0;
+	}
+	filter_reg = filter_reg - (filter_reg >> FILTER_SHIFT) + CLAMP(bldc_inputFilterPwm, -bldc_limitPwm, bldc_limitPwm);
 	bldc_outputFilterPwm = filter_reg >> FILTER_SHIFT;
   enginePOV(bldc_outputFilterPwm, pos, &y, &b, &g);
-	timer_channel_output_pulse_value_config(TIMER_BLDC, TIMER_BLDC_G, CLAMP(g + pwm_res / 2, 10, pwm_res-10));
-	timer_channel_output_pulse_value_config(TIMER_BLDC, TIMER_BLDC_B, CLAMP(b + pwm_res / 2, 10, pwm_res-10));
-	timer_channel_output_pulse_value_config(TIMER_BLDC, TIMER_BLDC_Y, CLAMP(y + pwm_res / 2, 10, pwm_res-10));
+	BLDC_CHCV(TIMER_BLDC_G) = CLAMP(g + pwm_res / 2, 10, pwm_res-10);
+	BLDC_CHCV(TIMER_BLDC_B) = CLAMP(b + pwm_res / 2, 10, pwm_res-10);
+	BLDC_CHCV(TIMER_BLDC_Y) = CLAMP(y + pwm_res / 2, 10, pwm_res-10);
 	if (lastPos != 1 && pos == 1) {
 		speedcount = speedtick;
 		speedtick = 0;
 	}
 	lastPos = pos;
 	speedtick++;
+	enginePublish();
+	engineCyclesUpdate(start);
 }
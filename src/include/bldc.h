@@ -17,6 +17,7 @@
 	#include "../framework/framework.h"
 	//    
 	#include "../define.h"
+	#include "../framework/ring.h"
 	
 	// 
 	//   
@@ -31,6 +32,29 @@
 	//   
 	# define BLDC_SINUS							BLDC_TRIANGULAR
 	
+	//  ,    
+	typedef struct {
+		//   
+		FlagStatus enable;
+		//       (0 -  )
+		uint8_t hall;
+		uint8_t pos;
+		// ,       ( -1000  1000)
+		int16_t setpoint;
+		int16_t limit;
+		int16_t duty;
+		//         (. /)
+		uint32_t period;
+		uint32_t speed;
+	} bldcState;
+	
+	// #BLDC# ------------------------------------------------------
+	// Description....: :      
+	//									  ,   .   fw_init()
+	// Argument.......: 
+	// ------------------------------------------------------------
+	void engineInit(void);
+	
 	// #BLDC# ------------------------------------------------------
 	// Description....:   
 	// Argument.......: 
@@ -45,6 +69,12 @@
 	// ------------------------------------------------------------
 	void engineMode(FlagStatus setMode);
 	
+	// #BLDC# ------------------------------------------------------
+	// Description....:    (SET - )
+	// Argument.......: 
+	// ------------------------------------------------------------
+	FlagStatus engineEnabled(void);
+	
 	// #BLDC# ------------------------------------------------------
 	// Description....:   
 	// Argument.......: 
@@ -53,7 +83,56 @@
 	void engineWrite(int16_t setPwm);
 	
 	// #BLDC# ------------------------------------------------------
-	// Description....:       
+	// Description....:   (    )
+	// Argument.......: 
+	//      uint16_t setLimit						=     0  1000
+	// ------------------------------------------------------------
+	void engineLimit(uint16_t setLimit);
+	
+	// #BLDC# ------------------------------------------------------
+	// Description....:     
+	// Argument.......: 
+	// ------------------------------------------------------------
+	int16_t engineDuty(void);
+	
+	// #BLDC# ------------------------------------------------------
+	// Description....:   (   )
+	// Argument.......: 
+	// ------------------------------------------------------------
+	uint32_t engineSpeed(void);
+	
+	// #BLDC# ------------------------------------------------------
+	// Description....:    (   )
+	// Argument.......: 
+	// ------------------------------------------------------------
+	FlagStatus engineHallFault(void);
+	
+	// #BLDC# ------------------------------------------------------
+	// Description....:        
+	//									(    ,   )
+	// Argument.......: 
+	//      bldcState *STATE						=  
+	// ------------------------------------------------------------
+	void engineSnapshot(bldcState *STATE);
+	
+	// #BLDC# ------------------------------------------------------
+	// Description....:    (EVENT_*  define.h), ERROR -  
+	//									  -  
+	// Argument.......: 
+	//      event *EVT									=   
+	// ------------------------------------------------------------
+	ErrStatus engineEvent(event *EVT);
+	
+	// #BLDC# ------------------------------------------------------
+	// Description....:        ( )
+	//									        (RAMFUNC_ENABLE)
+	// Argument.......: 
+	// ------------------------------------------------------------
+	uint32_t engineCycles(void);
+	
+	// #BLDC# ------------------------------------------------------
+	// Description....:       .    (RAMFUNC):
+	//									  TIMER0,  ,   
 	// Argument.......: 
 	// ------------------------------------------------------------
 	void enginePWM(void);
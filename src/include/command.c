@@ -0,0 +1,142 @@
+// #INDEX# ======================================================================================================
+// Title .........:       (COBS, CRC-16)
+// Arch ..........: GD32F130C8C6
+// Author ........: GreenBytes ( https://vk.com/greenbytes )
+// Version .......: 1.0.0.0
+// ==============================================================================================================
+
+//  
+//      
+#include "gd32f1x0.h"
+//  
+#include "command.h"
+//       (   linkWrite/linkMode)
+#include "bldc.h"
+#include "link.h"
+//  
+#include "../framework/framework.h"
+#include "../framework/scheduler.h"
+#include "../framework/serial.h"
+#include "../framework/frame.h"
+//    
+#include "../define.h"
+
+//     ( CRC)     ( CRC)
+# define COMMAND_DRIVE_SIZE							5
+# define COMMAND_RAW_SIZE								8
+
+//  :      DMA,    
+FRAME_DECODER(command_dec, COMMAND_RAW_SIZE);
+//   (   )    
+volatile int16_t command_setpoint = 0;
+volatile FlagStatus command_enable = RESET;
+volatile uint32_t command_time = 0;
+volatile FlagStatus command_fresh = RESET;
+//   
+volatile uint8_t command_seq = 0;
+//    (     )    
+int16_t command_out = 0;
+FlagStatus command_mode = RESET;
+FlagStatus command_active = RESET;
+uint16_t command_timeouts = 0;
+
+// #COMMAND# --------------------------------------------------
+// Description....:    (   ,  )
+//									 :      SERIAL_RX_SIZE 
+// Argument.......: 
+// ------------------------------------------------------------
+static void commandParse(void) {
+	uint16_t count = serialAvailable(SERIAL_AUX);
+	uint8_t *raw = command_dec.buf;
+	int16_t len;
+	while (count--) {
+		len = frameDecode(&command_dec, (uint8_t)serialRead(SERIAL_AUX));
+		if (len != COMMAND_DRIVE_SIZE || raw[0] != COMMAND_TYPE_DRIVE) continue;
+		command_seq = raw[1];
+		command_setpoint = (int16_t)CLAMP((int16_t)(raw[2] | (raw[3] << 8)), -1000, 1000);
+		command_enable = (raw[4] & COMMAND_F_ENABLE) ? SET : RESET;
+		command_time = millis();
+		command_fresh = SET;
+		//   ,    (  -    )
+		if (command_enable == SET && command_mode == SET) linkWrite(command_setpoint);
+	}
+}
+
+// #COMMAND# --------------------------------------------------
+// Description....:       ( , COMMAND_TASK_MS)
+//									    COMMAND_TIMEOUT_MS    
+//									 COMMAND_RAMP_STEP  ,    
+// Argument.......: 
+// ------------------------------------------------------------
+static void commandTask(void) {
+	if (command_fresh == SET) {
+		command_fresh = RESET;
+		command_active = SET;
+	}
+	if (command_active == RESET) return;
+	if (millis() - command_time <= COMMAND_TIMEOUT_MS) {
+		//     :      
+		if (command_enable != command_mode) {
+			command_mode = command_enable;
+			linkMode(command_mode);
+		}
+		command_out = (command_mode == SET) ? command_setpoint : 0;
+		linkWrite(command_out);
+		return;
+	}
+	if (command_out > COMMAND_RAMP_STEP) command_out -= COMMAND_RAMP_STEP;
+	else if (command_out < -COMMAND_RAMP_STEP) command_out += COMMAND_RAMP_STEP;
+	else command_out = 0;
+	linkWrite(command_out);
+	if (command_out != 0) return;
+	linkMode(RESET);
+	command_mode = RESET;
+	command_active = RESET;
+	command_timeouts++;
+}
+
+// #COMMAND# --------------------------------------------------
+// Description....:  ,    ( )
+// Argument.......: 
+// ------------------------------------------------------------
+static void commandStart(void) {
+	serialInit(SERIAL_AUX, AUX_BAUD, SERIAL_MODE_FULL);
+	serialOnIdle(SERIAL_AUX, commandParse);
+	schedAdd(commandTask, COMMAND_TASK_MS, SCHED_PRIO_HIGH);
+}
+
+// #COMMAND# --------------------------------------------------
+// Description....: :       (bootDefer)
+//									  fw_init()  engineInit().   ,  
+//									   (AUX_PROTOCOL)
+// Argument.......: 
+// ------------------------------------------------------------
+void commandInit(void) {
+	if (AUX_PROTOCOL != AUX_PROTOCOL_FRAME) return;
+	bootDefer(commandStart);
+}
+
+// #COMMAND# --------------------------------------------------
+// Description....:     (   COMMAND_TIMEOUT_MS
+//									      )
+// Argument.......: 
+// ------------------------------------------------------------
+FlagStatus commandActive(void) {
+	return command_active;
+}
+
+// #COMMAND# --------------------------------------------------
+// Description....:    ( COBS, CRC  )
+// Argument.......: 
+// ------------------------------------------------------------
+uint16_t commandErrors(void) {
+	return command_dec.errors;
+}
+
+// #COMMAND# --------------------------------------------------
+// Description....:    (     )
+// Argument.......: 
+// ------------------------------------------------------------
+uint16_t commandTimeouts(void) {
+	return command_timeouts;
+}
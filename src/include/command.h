@@ -0,0 +1,54 @@
+// #INDEX# ======================================================================================================
+// Title .........:       (COBS, CRC-16)
+// Arch ..........: GD32F130C8C6
+// Author ........: GreenBytes ( https://vk.com/greenbytes )
+// Version .......: 1.0.0.0
+// ==============================================================================================================
+
+#ifndef COMMAND_H
+
+	#define COMMAND_H
+
+	//  
+	//      
+	#include "gd32f1x0.h"
+
+	//  
+	#include "../framework/framework.h"
+	//    
+	#include "../define.h"
+
+	// : , ,  (  ), CRC-16 -   
+	//   : int16_t  (), uint8_t  COMMAND_F_*
+	# define COMMAND_TYPE_DRIVE						0x10
+	//   
+	//  
+	# define COMMAND_F_ENABLE							BIT(0)
+
+	// #COMMAND# --------------------------------------------------
+	// Description....: :       (bootDefer)
+	//									  fw_init()  engineInit().   ,  
+	//									   (AUX_PROTOCOL)
+	// Argument.......: 
+	// ------------------------------------------------------------
+	void commandInit(void);
+
+	// #COMMAND# --------------------------------------------------
+	// Description....:     (   COMMAND_TIMEOUT_MS
+	//									      )
+	// Argument.......: 
+	// ------------------------------------------------------------
+	FlagStatus commandActive(void);
+
+	// #COMMAND# --------------------------------------------------
+	// Description....:    ( COBS, CRC  )
+	// Argument.......: 
+	// ------------------------------------------------------------
+	uint16_t commandErrors(void);
+
+	// #COMMAND# --------------------------------------------------
+	// Description....:    (     )
+	// Argument.......: 
+	// ------------------------------------------------------------
+	uint16_t commandTimeouts(void);
+#endif
@@ -0,0 +1,77 @@
+// #INDEX# ======================================================================================================
+// Title .........:        
+// Arch ..........: GD32F130C8C6
+// Author ........: GreenBytes ( https://vk.com/greenbytes )
+// Version .......: 1.0.0.0
+// ==============================================================================================================
+
+//  
+//      
+#include "gd32f1x0.h"
+//    
+#include "derate.h"
+//   ,    
+#include "battery.h"
+#include "bldc.h"
+#include "thermal.h"
+//  
+#include "../framework/framework.h"
+//    
+#include "../define.h"
+
+//   ()
+# define DERATE_FULL										1000
+//   (  )
+# define DERATE_VOLT_K									FIX_MAP_K(BATTERY_CUTOFF_MV, BATTERY_CUTOFF_MV + DERATE_VOLT_SPAN_MV, DERATE_FLOOR, DERATE_FULL)
+# define DERATE_SOC_K										FIX_MAP_K(DERATE_SOC_MIN, DERATE_SOC_START, DERATE_FLOOR, DERATE_FULL)
+# define DERATE_MCU_K										FIX_MAP_K(DERATE_MCU_START, DERATE_MCU_MAX, DERATE_FULL, 0)
+
+//   ()
+uint16_t derate_limit = DERATE_FULL;
+//     ()
+int32_t derate_current = DERATE_FULL;
+
+// #DERATE# ----------------------------------------------------
+// Description....:    :  ,    
+//									  (batteryCurrentLimit),  ,  
+// Argument.......: 
+// ------------------------------------------------------------
+static int32_t derateCurrent(void) {
+	if (batteryCurrent() > batteryCurrentLimit()) derate_current -= DERATE_STEP_DOWN;
+	else derate_current += DERATE_STEP_UP;
+	derate_current = CLAMP(derate_current, 0, DERATE_FULL);
+	return derate_current;
+}
+
+// #DERATE# ----------------------------------------------------
+// Description....:     , ,  ,
+//									     / ,   engineLimit().
+//									  DERATE_TASK_MS  batteryTask()
+// Argument.......: 
+// ------------------------------------------------------------
+void derateTask(void) {
+	int32_t target, value;
+	//     
+	target = fixMapClamp(batteryVoltage(), BATTERY_CUTOFF_MV, BATTERY_CUTOFF_MV + DERATE_VOLT_SPAN_MV, DERATE_FLOOR, DERATE_FULL, DERATE_VOLT_K);
+	value = fixMapClamp(batterySoc(), DERATE_SOC_MIN, DERATE_SOC_START, DERATE_FLOOR, DERATE_FULL, DERATE_SOC_K);
+	if (value < target) target = value;
+	value = fixMapClamp(mcuTemperature(), DERATE_MCU_START, DERATE_MCU_MAX, DERATE_FULL, 0, DERATE_MCU_K);
+	if (value < target) target = value;
+	thermalTask();
+	value = thermalLimit();
+	if (value < target) target = value;
+	value = derateCurrent();
+	if (value < target) target = value;
+	//  ,    
+	target = CLAMP(target, (int32_t)derate_limit - DERATE_STEP_DOWN, (int32_t)derate_limit + DERATE_STEP_UP);
+	derate_limit = (uint16_t)target;
+	engineLimit(derate_limit);
+}
+
+// #DERATE# ----------------------------------------------------
+// Description....:    ()
+// Argument.......: 
+// ------------------------------------------------------------
+uint16_t derateLimit(void) {
+	return derate_limit;
+}
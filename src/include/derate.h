@@ -0,0 +1,34 @@
+// #INDEX# ======================================================================================================
+// Title .........:        
+// Arch ..........: GD32F130C8C6
+// Author ........: GreenBytes ( https://vk.com/greenbytes )
+// Version .......: 1.0.0.0
+// ==============================================================================================================
+
+#ifndef DERATE_H
+
+	#define DERATE_H
+
+	//  
+	//      
+	#include "gd32f1x0.h"
+
+	//  
+	#include "../framework/framework.h"
+	//    
+	#include "../define.h"
+
+	// #DERATE# ----------------------------------------------------
+	// Description....:     , ,  ,
+	//									     / ,   engineLimit().   DERATE_TASK_MS
+	//									 batteryTask()
+	// Argument.......: 
+	// ------------------------------------------------------------
+	void derateTask(void);
+
+	// #DERATE# ----------------------------------------------------
+	// Description....:    ()
+	// Argument.......: 
+	// ------------------------------------------------------------
+	uint16_t derateLimit(void);
+#endif
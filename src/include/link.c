@@ -0,0 +1,255 @@
+// #INDEX# ======================================================================================================
+// Title .........:    (/)       
+// Arch ..........: GD32F130C8C6
+// Author ........: GreenBytes ( https://vk.com/greenbytes )
+// Version .......: 1.0.0.0
+// ==============================================================================================================
+
+//  
+//      
+#include "gd32f1x0.h"
+//   
+#include "link.h"
+//   
+#include "bldc.h"
+//  
+#include "../framework/framework.h"
+#include "../framework/scheduler.h"
+#include "../framework/serial.h"
+#include "../framework/frame.h"
+//    
+#include "../define.h"
+
+//    ( CRC)    ( CRC)
+# define LINK_FRAME_SIZE								5
+# define LINK_RAW_SIZE									8
+# define LINK_TX_SIZE										FRAME_COBS_SIZE(LINK_RAW_SIZE)
+//   ,       (LINK_TIMEOUT_MS)
+# define LINK_GAP_MAX										(LINK_TIMEOUT_MS / LINK_PERIOD_MS + 1)
+
+//    (     DMA)
+FRAME_DECODER(link_dec, LINK_RAW_SIZE);
+//     
+uint8_t link_raw[LINK_RAW_SIZE];
+uint8_t link_tx[LINK_TX_SIZE];
+//  (  -  linkWrite/linkMode,   -   )   
+volatile int16_t link_setpoint = 0;
+volatile FlagStatus link_enable = RESET;
+volatile uint8_t link_seq = 0;
+//     ,    ,    
+volatile uint32_t link_time = 0;
+volatile uint8_t link_peerFlags = 0;
+volatile FlagStatus link_seen = RESET;
+//        (     )
+FlagStatus link_mode = RESET;
+int16_t link_out = 0;
+uint16_t link_lost = 0;
+//  :        
+FlagStatus link_started = RESET;
+#if !LINK_MASTER
+//     
+volatile FlagStatus link_fresh = RESET;
+#endif
+
+// #LINK# -----------------------------------------------------
+// Description....:      DMA  
+// Argument.......:
+//      uint8_t TYPE								=   (LINK_TYPE_*)
+//      uint8_t SEQ									=  
+//      int16_t VALUE								= 
+//      uint8_t FLAGS								=  LINK_F_*
+// ------------------------------------------------------------
+static ErrStatus linkSend(uint8_t TYPE, uint8_t SEQ, int16_t VALUE, uint8_t FLAGS) {
+	if (serialBusy(SERIAL_LINK) == SET) return ERROR;
+	link_raw[0] = TYPE;
+	link_raw[1] = SEQ;
+	link_raw[2] = (uint8_t)VALUE;
+	link_raw[3] = (uint8_t)((uint16_t)VALUE >> 8);
+	link_raw[4] = FLAGS;
+	return serialSend(SERIAL_LINK, link_tx, frameEncode(link_raw, LINK_FRAME_SIZE, link_tx));
+}
+
+// #LINK# -----------------------------------------------------
+// Description....:        (LINK_RAMP_STEP  )
+// Argument.......: 
+// ------------------------------------------------------------
+static void linkRamp(void) {
+	if (link_out > LINK_RAMP_STEP) link_out -= LINK_RAMP_STEP;
+	else if (link_out < -LINK_RAMP_STEP) link_out += LINK_RAMP_STEP;
+	else link_out = 0;
+}
+
+#if LINK_MASTER
+// #LINK# -----------------------------------------------------
+// Description....:    (   ,  )
+// Argument.......: 
+// ------------------------------------------------------------
+static void linkParse(void) {
+	uint16_t count = serialAvailable(SERIAL_LINK);
+	uint8_t *raw = link_dec.buf;
+	while (count--) {
+		if (frameDecode(&link_dec, (uint8_t)serialRead(SERIAL_LINK)) != LINK_FRAME_SIZE || raw[0] != LINK_TYPE_STATUS) continue;
+		link_peerFlags = raw[4];
+		link_time = millis();
+		link_seen = SET;
+	}
+}
+
+// #LINK# -----------------------------------------------------
+// Description....:          ( ,
+//									LINK_PERIOD_MS).     ,  
+//									          
+//									     LINK_TIMEOUT_MS,   
+//									    LINK_RAMP_STEP      
+//									 :    
+// Argument.......: 
+// ------------------------------------------------------------
+static void linkTask(void) {
+	FlagStatus enable = link_enable;
+	if (linkOnline() == SET) link_out = (enable == SET) ? link_setpoint : 0;
+	else linkRamp();
+	if (linkSend(LINK_TYPE_DRIVE, (uint8_t)(link_seq + 1), link_out, (enable == SET) ? LINK_F_ENABLE : 0) == ERROR) {
+		link_lost++;
+		return;
+	}
+	link_seq++;
+	if (enable != link_mode) {
+		link_mode = enable;
+		engineMode(link_mode);
+	}
+	engineWrite(link_out);
+}
+#else
+// #LINK# -----------------------------------------------------
+// Description....:    (   ,  )
+//									  ,    DMA  
+// Argument.......: 
+// ------------------------------------------------------------
+static void linkParse(void) {
+	uint16_t count = serialAvailable(SERIAL_LINK);
+	uint8_t *raw = link_dec.buf;
+	uint8_t gap;
+	while (count--) {
+		if (frameDecode(&link_dec, (uint8_t)serialRead(SERIAL_LINK)) != LINK_FRAME_SIZE || raw[0] != LINK_TYPE_DRIVE) continue;
+		//       
+		gap = (uint8_t)(raw[1] - link_seq);
+		if (link_seen == SET && gap == 0) continue;
+		//  ,        ( ) - :
+		//         
+		if (linkOnline() == SET && gap <= LINK_GAP_MAX) link_lost += gap - 1;
+		link_seq = raw[1];
+		link_setpoint = (int16_t)CLAMP((int16_t)(raw[2] | (raw[3] << 8)), -1000, 1000);
+		link_enable = (raw[4] & LINK_F_ENABLE) ? SET : RESET;
+		link_peerFlags = raw[4];
+		link_time = millis();
+		link_seen = SET;
+		link_fresh = SET;
+		if (link_enable == SET && link_mode == SET) engineWrite(link_setpoint);
+		linkSend(LINK_TYPE_STATUS, link_seq, engineDuty(), (uint8_t)((engineEnabled() == SET ? LINK_F_ENABLE : 0) | (engineHallFault() == SET ? LINK_F_FAULT : 0)));
+	}
+}
+
+// #LINK# -----------------------------------------------------
+// Description....:      ( , LINK_PERIOD_MS)
+//									    LINK_TIMEOUT_MS    
+//									 LINK_RAMP_STEP  ,    
+// Argument.......: 
+// ------------------------------------------------------------
+static void linkTask(void) {
+	if (link_fresh == SET) {
+		link_fresh = RESET;
+		//      :     
+		if (link_enable != link_mode) {
+			link_mode = link_enable;
+			engineMode(link_mode);
+		}
+	}
+	if (linkOnline() == SET) {
+		link_out = (link_mode == SET) ? link_setpoint : 0;
+		engineWrite(link_out);
+		return;
+	}
+	if (link_mode == RESET) return;
+	linkRamp();
+	engineWrite(link_out);
+	if (link_out != 0) return;
+	link_mode = RESET;
+	engineMode(RESET);
+}
+#endif
+
+// #LINK# -----------------------------------------------------
+// Description....:  ,    ( )
+// Argument.......: 
+// ------------------------------------------------------------
+static void linkStart(void) {
+	link_started = SET;
+	serialInit(SERIAL_LINK, LINK_BAUD, SERIAL_MODE_FULL);
+	serialOnIdle(SERIAL_LINK, linkParse);
+	schedAdd(linkTask, LINK_PERIOD_MS, SCHED_PRIO_HIGH);
+}
+
+// #LINK# -----------------------------------------------------
+// Description....: :       (bootDefer)
+//									  LINK_MASTER.   fw_init()  engineInit()
+// Argument.......: 
+// ------------------------------------------------------------
+void linkInit(void) {
+	bootDefer(linkStart);
+}
+
+// #LINK# -----------------------------------------------------
+// Description....:      (, )  engineWrite
+//									    -   .   
+//									      (   ),
+//									  :    
+// Argument.......:
+//      int16_t setPwm							=    -1000  1000
+// ------------------------------------------------------------
+void linkWrite(int16_t setPwm) {
+	if (link_started == RESET) engineWrite(setPwm);
+	else if (LINK_MASTER) link_setpoint = CLAMP(setPwm, -1000, 1000);
+}
+
+// #LINK# -----------------------------------------------------
+// Description....:       engineMode ( linkWrite)
+// Argument.......:
+//      FlagStatus setMode					= SET - , RESET - 
+// ------------------------------------------------------------
+void linkMode(FlagStatus setMode) {
+	if (link_started == RESET) engineMode(setMode);
+	else if (LINK_MASTER) link_enable = setMode;
+}
+
+// #LINK# -----------------------------------------------------
+// Description....:    (      LINK_TIMEOUT_MS)
+// Argument.......: 
+// ------------------------------------------------------------
+FlagStatus linkOnline(void) {
+	return (link_seen == SET && millis() - link_time <= LINK_TIMEOUT_MS) ? SET : RESET;
+}
+
+// #LINK# -----------------------------------------------------
+// Description....:      (LINK_F_*)
+// Argument.......: 
+// ------------------------------------------------------------
+uint8_t linkPeerFlags(void) {
+	return link_peerFlags;
+}
+
+// #LINK# -----------------------------------------------------
+// Description....:   :    , 
+//									  
+// Argument.......: 
+// ------------------------------------------------------------
+uint16_t linkLost(void) {
+	return link_lost;
+}
+
+// #LINK# -----------------------------------------------------
+// Description....:    ( COBS, CRC  )
+// Argument.......: 
+// ------------------------------------------------------------
+uint16_t linkErrors(void) {
+	return link_dec.errors;
+}
@@ -0,0 +1,80 @@
+// #INDEX# ======================================================================================================
+// Title .........:    (/)       
+// Arch ..........: GD32F130C8C6
+// Author ........: GreenBytes ( https://vk.com/greenbytes )
+// Version .......: 1.0.0.0
+// ==============================================================================================================
+
+#ifndef LINK_H
+
+	#define LINK_H
+
+	//  
+	//      
+	#include "gd32f1x0.h"
+
+	//  
+	#include "../framework/framework.h"
+	//    
+	#include "../define.h"
+
+	//  (COBS, CRC-16): , , int16_t  (  ),  LINK_F_*
+	//  :     ,  -  ()
+	# define LINK_TYPE_DRIVE							0x20
+	//      :   ,  -    
+	# define LINK_TYPE_STATUS							0x21
+	// 
+	//  
+	# define LINK_F_ENABLE								BIT(0)
+	//    (   )
+	# define LINK_F_FAULT									BIT(1)
+
+	// #LINK# -----------------------------------------------------
+	// Description....: :       (bootDefer)
+	//									  LINK_MASTER.   fw_init()  engineInit()
+	// Argument.......: 
+	// ------------------------------------------------------------
+	void linkInit(void);
+
+	// #LINK# -----------------------------------------------------
+	// Description....:      (, )  engineWrite
+	//									    -   .   
+	//									      (   ),
+	//									  :    
+	// Argument.......:
+	//      int16_t setPwm							=    -1000  1000
+	// ------------------------------------------------------------
+	void linkWrite(int16_t setPwm);
+
+	// #LINK# -----------------------------------------------------
+	// Description....:       engineMode ( linkWrite)
+	// Argument.......:
+	//      FlagStatus setMode					= SET - , RESET - 
+	// ------------------------------------------------------------
+	void linkMode(FlagStatus setMode);
+
+	// #LINK# -----------------------------------------------------
+	// Description....:    (      LINK_TIMEOUT_MS)
+	// Argument.......: 
+	// ------------------------------------------------------------
+	FlagStatus linkOnline(void);
+
+	// #LINK# -----------------------------------------------------
+	// Description....:      (LINK_F_*)
+	// Argument.......: 
+	// ------------------------------------------------------------
+	uint8_t linkPeerFlags(void);
+
+	// #LINK# -----------------------------------------------------
+	// Description....:   :    , 
+	//									  
+	// Argument.......: 
+	// ------------------------------------------------------------
+	uint16_t linkLost(void);
+
+	// #LINK# -----------------------------------------------------
+	// Description....:    ( COBS, CRC  )
+	// Argument.......: 
+	// ------------------------------------------------------------
+	uint16_t linkErrors(void);
+#endif
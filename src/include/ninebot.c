@@ -0,0 +1,262 @@
+// #INDEX# ======================================================================================================
+// Title .........:    "55 AA" (Xiaomi/Ninebot)   
+// Arch ..........: GD32F130C8C6
+// Author ........: GreenBytes ( https://vk.com/greenbytes )
+// Version .......: 1.0.0.0
+// ==============================================================================================================
+
+//  
+//      
+#include "gd32f1x0.h"
+//   
+#include "ninebot.h"
+//   ,     (   linkWrite/linkMode)
+#include "bldc.h"
+#include "battery.h"
+#include "link.h"
+//  
+#include "../framework/framework.h"
+#include "../framework/scheduler.h"
+#include "../framework/serial.h"
+//    
+#include "../define.h"
+
+//   : , , , , ,  
+# define NINEBOT_OVERHEAD								8
+//    (  - 13 )      
+# define NINEBOT_RX_SIZE								16
+# define NINEBOT_READ_MAX								32
+# define NINEBOT_TX_SIZE								(NINEBOT_READ_MAX + NINEBOT_OVERHEAD)
+// :    -> , : . / -> / (  )
+# define NINEBOT_THROTTLE_K							FIX_MAP_K(NINEBOT_THROTTLE_MIN, NINEBOT_THROTTLE_MAX, 0, 1000)
+# define NINEBOT_SPEED_K								FIX_Q16(WHEEL_LENGTH_MM * 60.0 / (WHEEL_POLE_PAIRS * 1000.0))
+
+//  :     DMA  ,    
+uint8_t ninebot_rx[NINEBOT_RX_SIZE];
+uint8_t ninebot_pos = 0;
+//  (  DMA,  serialBusy())
+uint8_t ninebot_tx[NINEBOT_TX_SIZE];
+//  (),      
+volatile uint16_t ninebot_throttle = 0;
+volatile FlagStatus ninebot_brake = RESET;
+volatile uint32_t ninebot_time = 0;
+volatile FlagStatus ninebot_fresh = RESET;
+//    (     )   
+int16_t ninebot_out = 0;
+FlagStatus ninebot_active = RESET;
+uint16_t ninebot_errors = 0;
+
+// #NINEBOT# --------------------------------------------------
+// Description....:  :   
+// Argument.......:
+//      const uint8_t *DATA					=  (     )
+//      uint8_t LEN									= 
+// ------------------------------------------------------------
+static uint16_t ninebotSum(const uint8_t *DATA, uint8_t LEN) {
+	uint16_t sum = 0;
+	while (LEN--) sum += *DATA++;
+	return (uint16_t)~sum;
+}
+
+// #NINEBOT# --------------------------------------------------
+// Description....:    DMA  
+// Argument.......:
+//      uint8_t ADDR								=  (NINEBOT_ADDR_*)
+//      uint8_t CMD									= 
+//      uint8_t ARG									= 
+//      uint8_t LEN									=   (    ninebot_tx  6- ,
+//																		   )
+// ------------------------------------------------------------
+static void ninebotReply(uint8_t ADDR, uint8_t CMD, uint8_t ARG, uint8_t LEN) {
+	uint16_t sum;
+	ninebot_tx[0] = NINEBOT_HEAD0;
+	ninebot_tx[1] = NINEBOT_HEAD1;
+	ninebot_tx[2] = (uint8_t)(LEN + 2);
+	ninebot_tx[3] = ADDR;
+	ninebot_tx[4] = CMD;
+	ninebot_tx[5] = ARG;
+	sum = ninebotSum(&ninebot_tx[2], (uint8_t)(LEN + 4));
+	ninebot_tx[LEN + 6] = (uint8_t)sum;
+	ninebot_tx[LEN + 7] = (uint8_t)(sum >> 8);
+	serialSend(SERIAL_AUX, ninebot_tx, (uint16_t)(LEN + 8));
+}
+
+// #NINEBOT# --------------------------------------------------
+// Description....:    (    0)
+// Argument.......:
+//      uint8_t REG									=  
+// ------------------------------------------------------------
+static uint16_t ninebotRegister(uint8_t REG) {
+	switch (REG) {
+		case NINEBOT_REG_ERROR:
+			return (engineHallFault() == SET) ? NINEBOT_ERROR_HALL : 0;
+		case NINEBOT_REG_SOC:
+			return batterySoc() / 100;
+		case NINEBOT_REG_SPEED:
+			return (uint16_t)MAX(fixScale(engineSpeed(), NINEBOT_SPEED_K), 0x7FFF);
+		default:
+			return 0;
+	}
+}
+
+// #NINEBOT# --------------------------------------------------
+// Description....:    
+// Argument.......:
+//      const uint8_t *FRAME				=  ( ,   )
+// ------------------------------------------------------------
+static void ninebotFrame(const uint8_t *FRAME) {
+	uint8_t len = (uint8_t)(FRAME[2] - 2);
+	const uint8_t *data = &FRAME[6];
+	uint8_t i, count;
+	uint16_t value;
+	//   (    )     
+	if (FRAME[3] != NINEBOT_ADDR_ESC) return;
+	switch (FRAME[4]) {
+		case NINEBOT_CMD_THROTTLE:
+		case NINEBOT_CMD_THROTTLE_NR:
+			// : , , , ...
+			if (len < 3) return;
+			ninebot_throttle = (uint16_t)fixMapClamp(data[1], NINEBOT_THROTTLE_MIN, NINEBOT_THROTTLE_MAX, 0, 1000, NINEBOT_THROTTLE_K);
+			ninebot_brake = (data[2] >= NINEBOT_BRAKE_ON) ? SET : RESET;
+			ninebot_time = millis();
+			ninebot_fresh = SET;
+			//   ,    (  -    )
+			if (ninebot_active == SET) linkWrite((ninebot_brake == SET) ? 0 : (int16_t)ninebot_throttle);
+			if (FRAME[4] == NINEBOT_CMD_THROTTLE_NR || serialBusy(SERIAL_AUX) == SET) return;
+			//   : , , ,  
+			ninebot_tx[6] = 0;
+			ninebot_tx[7] = (uint8_t)(batterySoc() / 100);
+			ninebot_tx[8] = 0;
+			ninebot_tx[9] = 0;
+			ninebotReply(NINEBOT_ADDR_BLE, NINEBOT_CMD_THROTTLE, 0, 4);
+			return;
+		case NINEBOT_CMD_READ:
+			//  -  ,  -  
+			if (len < 1 || serialBusy(SERIAL_AUX) == SET) return;
+			count = (uint8_t)MAX(data[0] & ~1U, NINEBOT_READ_MAX);
+			for (i = 0; i < count; i += 2) {
+				value = ninebotRegister((uint8_t)(FRAME[5] + i / 2));
+				ninebot_tx[6 + i] = (uint8_t)value;
+				ninebot_tx[7 + i] = (uint8_t)(value >> 8);
+			}
+			ninebotReply(NINEBOT_ADDR_REPLY, NINEBOT_CMD_READ, FRAME[5], count);
+			return;
+		default:
+			return;
+	}
+}
+
+// #NINEBOT# --------------------------------------------------
+// Description....:    (   ,  )
+//									 :      SERIAL_RX_SIZE , 
+//									     
+// Argument.......: 
+// ------------------------------------------------------------
+static void ninebotParse(void) {
+	uint16_t count = serialAvailable(SERIAL_AUX);
+	uint8_t *rx = ninebot_rx;
+	uint8_t data;
+	while (count--) {
+		data = (uint8_t)serialRead(SERIAL_AUX);
+		//  
+		if (ninebot_pos == 0 && data != NINEBOT_HEAD0) continue;
+		if (ninebot_pos == 1 && data != NINEBOT_HEAD1) {
+			ninebot_pos = (data == NINEBOT_HEAD0) ? 1 : 0;
+			continue;
+		}
+		//   (      )   - 
+		if (ninebot_pos == 2 && (data < 2 || data - 2 + NINEBOT_OVERHEAD > NINEBOT_RX_SIZE)) {
+			ninebot_pos = 0;
+			continue;
+		}
+		rx[ninebot_pos++] = data;
+		if (ninebot_pos < 3 || ninebot_pos < rx[2] - 2 + NINEBOT_OVERHEAD) continue;
+		ninebot_pos = 0;
+		if (ninebotSum(&rx[2], (uint8_t)(rx[2] + 2)) != (uint16_t)(rx[rx[2] + 4] | (rx[rx[2] + 5] << 8))) {
+			ninebot_errors++;
+			continue;
+		}
+		ninebotFrame(rx);
+	}
+}
+
+// #NINEBOT# --------------------------------------------------
+// Description....:      ( , NINEBOT_TASK_MS)
+//									     .   
+//									NINEBOT_TIMEOUT_MS      NINEBOT_RAMP_STEP  ,
+//									   
+// Argument.......: 
+// ------------------------------------------------------------
+static void ninebotTask(void) {
+	if (ninebot_fresh == SET) {
+		ninebot_fresh = RESET;
+		if (ninebot_active == RESET) {
+			ninebot_active = SET;
+			linkMode(SET);
+		}
+	}
+	if (ninebot_active == RESET) return;
+	if (ninebotOnline() == SET) {
+		ninebot_out = (ninebot_brake == SET) ? 0 : (int16_t)ninebot_throttle;
+		linkWrite(ninebot_out);
+		return;
+	}
+	ninebot_out = (ninebot_out > NINEBOT_RAMP_STEP) ? ninebot_out - NINEBOT_RAMP_STEP : 0;
+	linkWrite(ninebot_out);
+	if (ninebot_out != 0) return;
+	linkMode(RESET);
+	ninebot_active = RESET;
+}
+
+// #NINEBOT# --------------------------------------------------
+// Description....:  ,    ( )
+// Argument.......: 
+// ------------------------------------------------------------
+static void ninebotStart(void) {
+	serialInit(SERIAL_AUX, AUX_BAUD, SERIAL_MODE_HALF);
+	serialOnIdle(SERIAL_AUX, ninebotParse);
+	schedAdd(ninebotTask, NINEBOT_TASK_MS, SCHED_PRIO_HIGH);
+}
+
+// #NINEBOT# --------------------------------------------------
+// Description....: :  (, PIN_AUX_TX)    
+//									 (bootDefer).   fw_init()  engineInit()
+//									  ,  AUX_PROTOCOL  AUX_PROTOCOL_NINEBOT
+// Argument.......: 
+// ------------------------------------------------------------
+void ninebotInit(void) {
+	if (AUX_PROTOCOL != AUX_PROTOCOL_NINEBOT) return;
+	bootDefer(ninebotStart);
+}
+
+// #NINEBOT# --------------------------------------------------
+// Description....:    (,  0  1000)
+// Argument.......: 
+// ------------------------------------------------------------
+uint16_t ninebotThrottle(void) {
+	return ninebot_throttle;
+}
+
+// #NINEBOT# --------------------------------------------------
+// Description....:   
+// Argument.......: 
+// ------------------------------------------------------------
+FlagStatus ninebotBrake(void) {
+	return ninebot_brake;
+}
+
+// #NINEBOT# --------------------------------------------------
+// Description....:      (   NINEBOT_TIMEOUT_MS)
+// Argument.......: 
+// ------------------------------------------------------------
+FlagStatus ninebotOnline(void) {
+	return (ninebot_active == SET && millis() - ninebot_time <= NINEBOT_TIMEOUT_MS) ? SET : RESET;
+}
+
+// #NINEBOT# --------------------------------------------------
+// Description....:    (  )
+// Argument.......: 
+// ------------------------------------------------------------
+uint16_t ninebotErrors(void) {
+	return ninebot_errors;
+}
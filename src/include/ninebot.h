@@ -0,0 +1,74 @@
+// #INDEX# ======================================================================================================
+// Title .........:    "55 AA" (Xiaomi/Ninebot)   
+// Arch ..........: GD32F130C8C6
+// Author ........: GreenBytes ( https://vk.com/greenbytes )
+// Version .......: 1.0.0.0
+// ==============================================================================================================
+
+#ifndef NINEBOT_H
+
+	#define NINEBOT_H
+
+	//  
+	//      
+	#include "gd32f1x0.h"
+
+	//  
+	#include "../framework/framework.h"
+	//    
+	#include "../define.h"
+
+	// : 55 AA,  ( + 2), , , , ,  
+	// (       ,   )
+	# define NINEBOT_HEAD0								0x55
+	# define NINEBOT_HEAD1								0xAA
+	// :  -> ,  ->  (  ),  
+	# define NINEBOT_ADDR_ESC							0x20
+	# define NINEBOT_ADDR_BLE							0x21
+	# define NINEBOT_ADDR_REPLY						0x23
+	// :  ,      ,     
+	# define NINEBOT_CMD_READ							0x01
+	# define NINEBOT_CMD_THROTTLE					0x64
+	# define NINEBOT_CMD_THROTTLE_NR			0x65
+	//   (16 ),   
+	//  
+	# define NINEBOT_REG_ERROR						0xB0
+	//  (%)
+	# define NINEBOT_REG_SOC							0xB4
+	//  (/)
+	# define NINEBOT_REG_SPEED						0xB5
+	//     (   )
+	# define NINEBOT_ERROR_HALL						18
+
+	// #NINEBOT# --------------------------------------------------
+	// Description....: :  (, PIN_AUX_TX)    
+	//									 (bootDefer).   fw_init()  engineInit()
+	//									  ,  AUX_PROTOCOL  AUX_PROTOCOL_NINEBOT
+	// Argument.......: 
+	// ------------------------------------------------------------
+	void ninebotInit(void);
+
+	// #NINEBOT# --------------------------------------------------
+	// Description....:    (,  0  1000)
+	// Argument.......: 
+	// ------------------------------------------------------------
+	uint16_t ninebotThrottle(void);
+
+	// #NINEBOT# --------------------------------------------------
+	// Description....:   
+	// Argument.......: 
+	// ------------------------------------------------------------
+	FlagStatus ninebotBrake(void);
+
+	// #NINEBOT# --------------------------------------------------
+	// Description....:      (   NINEBOT_TIMEOUT_MS)
+	// Argument.......: 
+	// ------------------------------------------------------------
+	FlagStatus ninebotOnline(void);
+
+	// #NINEBOT# --------------------------------------------------
+	// Description....:    (  )
+	// Argument.......: 
+	// ------------------------------------------------------------
+	uint16_t ninebotErrors(void);
+#endif
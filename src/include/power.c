@@ -0,0 +1,228 @@
+// #INDEX# ======================================================================================================
+// Title .........:  :  ,   ,  
+// Arch ..........: GD32F130C8C6
+// Author ........: GreenBytes ( https://vk.com/greenbytes )
+// Version .......: 1.0.0.0
+// ==============================================================================================================
+
+//  
+//      
+#include "gd32f1x0.h"
+//   
+#include "power.h"
+//     
+#include "bldc.h"
+#include "battery.h"
+//  
+#include "../framework/framework.h"
+//    
+#include "../define.h"
+
+//  EXTI,  EXTI    
+# define POWER_EXTI											0x40010400U
+# define POWER_EXTI_EVEN								REG32(POWER_EXTI + 0x04U)
+# define POWER_EXTI_RTEN								REG32(POWER_EXTI + 0x08U)
+# define POWER_EXTI_FTEN								REG32(POWER_EXTI + 0x0CU)
+# define POWER_EXTI_PD									REG32(POWER_EXTI + 0x14U)
+//  EXTI  (  PIN_POWER)
+# define POWER_EXTI_LINE								getPin(PIN_POWER)
+//  EXTI  RTC
+# define POWER_EXTI_ALARM								BIT(17)
+
+//  RTC,  RTC    
+# define POWER_RTC											0x40002800U
+# define POWER_RTC_CTL									REG32(POWER_RTC + 0x08U)
+# define POWER_RTC_STAT									REG32(POWER_RTC + 0x0CU)
+# define POWER_RTC_PSC									REG32(POWER_RTC + 0x10U)
+# define POWER_RTC_ALRM0TD							REG32(POWER_RTC + 0x1CU)
+# define POWER_RTC_WPK									REG32(POWER_RTC + 0x24U)
+# define POWER_RTC_CTL_ALRM0EN					BIT(8)
+# define POWER_RTC_STAT_ALRM0WF					BIT(0)
+# define POWER_RTC_STAT_INITF						BIT(6)
+# define POWER_RTC_STAT_INITM						BIT(7)
+# define POWER_RTC_STAT_ALRM0F					BIT(8)
+//     (MSKD, MSKH, MSKM, MSKS) -   
+# define POWER_RTC_ALRM0_EVERY_SECOND		(BIT(31) | BIT(23) | BIT(15) | BIT(7))
+//  IRC40K: 128 * 312 = 39936    RTC.   
+//    IRC40K (4096 * 16 = 65536 ),     
+//     
+# define POWER_RTC_PSC_ASYNC						127U
+# define POWER_RTC_PSC_SYNC							311U
+FIX_STATIC_ASSERT((POWER_RTC_PSC_ASYNC + 1) * (POWER_RTC_PSC_SYNC + 1) < 0x1000UL * 16UL, power_alarm);
+//  EXTI   PC15 (SYSCFG_EXTISS3)
+FIX_STATIC_ASSERT(PIN_POWER == PC15, power_pin);
+
+//      
+# define POWER_MAGIC										0x534C5045
+
+//  :     
+typedef struct {
+	uint32_t magic;
+	uint32_t sleeping;
+} powerState;
+
+NOINIT powerState power_state;
+
+//    ()
+uint32_t power_activity = 0;
+
+// #POWER# -----------------------------------------------------
+// Description....:   -    ,     
+// Argument.......: 
+// ------------------------------------------------------------
+static void powerHold(void) {
+	rcu_periph_clock_enable(RCU_GPIOB);
+	rcu_periph_clock_enable(RCU_GPIOC);
+	digitalWrite(PIN_SELF_HOLD, HIGH);
+	pinMode(PIN_SELF_HOLD, OUTPUT, GPIO_OSPEED_2MHZ);
+	pinMode(PIN_POWER, INPUT, 0);
+}
+
+// #POWER# -----------------------------------------------------
+// Description....:  RTC  IRC40K    ( EXTI 17) -  
+//									deep-sleep       .
+//									      (   )
+// Argument.......: 
+// ------------------------------------------------------------
+static void powerAlarmStart(void) {
+	rcu_osci_on(RCU_IRC40K);
+	rcu_osci_stab_wait(RCU_IRC40K);
+	pmu_backup_write_enable();
+	rcu_rtc_clock_config(RCU_RTCSRC_IRC40K);
+	rcu_periph_clock_enable(RCU_RTC);
+	POWER_RTC_WPK = 0xCA;
+	POWER_RTC_WPK = 0x53;
+	POWER_RTC_STAT |= POWER_RTC_STAT_INITM;
+	while (!(POWER_RTC_STAT & POWER_RTC_STAT_INITF));
+	POWER_RTC_PSC = (POWER_RTC_PSC_ASYNC << 16) | POWER_RTC_PSC_SYNC;
+	POWER_RTC_STAT &= ~POWER_RTC_STAT_INITM;
+	POWER_RTC_CTL &= ~POWER_RTC_CTL_ALRM0EN;
+	while (!(POWER_RTC_STAT & POWER_RTC_STAT_ALRM0WF));
+	POWER_RTC_ALRM0TD = POWER_RTC_ALRM0_EVERY_SECOND;
+	POWER_RTC_STAT &= ~POWER_RTC_STAT_ALRM0F;
+	POWER_RTC_CTL |= POWER_RTC_CTL_ALRM0EN;
+	POWER_EXTI_RTEN |= POWER_EXTI_ALARM;
+	POWER_EXTI_EVEN |= POWER_EXTI_ALARM;
+}
+
+// #POWER# -----------------------------------------------------
+// Description....:   RTC      
+// Argument.......: 
+// ------------------------------------------------------------
+static void powerAlarmStop(void) {
+	POWER_EXTI_EVEN &= ~POWER_EXTI_ALARM;
+	POWER_EXTI_RTEN &= ~POWER_EXTI_ALARM;
+	POWER_EXTI_PD = POWER_EXTI_ALARM;
+	POWER_RTC_CTL &= ~POWER_RTC_CTL_ALRM0EN;
+	POWER_RTC_STAT &= ~POWER_RTC_STAT_ALRM0F;
+	POWER_RTC_WPK = 0xFF;
+	pmu_backup_write_disable();
+}
+
+// #POWER# -----------------------------------------------------
+// Description....:   PLL 72   deep-sleep.   (  
+//									 )  ,    SystemInit()
+// Argument.......: 
+// ------------------------------------------------------------
+static void powerClockRestore(void) {
+	rcu_osci_on(RCU_PLL_CK);
+	rcu_osci_stab_wait(RCU_PLL_CK);
+	rcu_system_clock_source_config(RCU_CKSYSSRC_PLL);
+	while (rcu_system_clock_source_get() != RCU_SCSS_PLL);
+	SystemCoreClockUpdate();
+}
+
+// #POWER# -----------------------------------------------------
+// Description....: Deep-sleep   :  EXTI     (WFE),
+//									   .    deep-sleep 
+//									,        
+//									RTC,     ,   
+// Argument.......: 
+// ------------------------------------------------------------
+static void powerDeepSleep(void) {
+	rcu_periph_clock_enable(RCU_CFGCMP);
+	rcu_periph_clock_enable(RCU_PMU);
+	syscfg_exti_line_config(EXTI_SOURCE_GPIOC, EXTI_SOURCE_PIN15);
+	if (POWER_BUTTON_ACTIVE == SET) POWER_EXTI_RTEN |= POWER_EXTI_LINE;
+	else POWER_EXTI_FTEN |= POWER_EXTI_LINE;
+	POWER_EXTI_EVEN |= POWER_EXTI_LINE;
+	powerAlarmStart();
+	do {
+		POWER_RTC_STAT &= ~POWER_RTC_STAT_ALRM0F;
+		POWER_EXTI_PD = POWER_EXTI_LINE | POWER_EXTI_ALARM;
+		fwdgt_counter_reload();
+		pmu_to_deepsleepmode(PMU_LDO_LOWPOWER, WFE_CMD);
+	} while (digitalRead(PIN_POWER) != POWER_BUTTON_ACTIVE);
+	powerAlarmStop();
+	POWER_EXTI_EVEN &= ~POWER_EXTI_LINE;
+	POWER_EXTI_RTEN &= ~POWER_EXTI_LINE;
+	POWER_EXTI_FTEN &= ~POWER_EXTI_LINE;
+	POWER_EXTI_PD = POWER_EXTI_LINE;
+	//  deep-sleep    IRC8M
+	powerClockRestore();
+}
+
+// #POWER# -----------------------------------------------------
+// Description....:  :    main(),  fw_init()
+//									           (
+//									 ),       
+//									   .     , 
+//									faultResetCause()      
+// Argument.......: 
+// ------------------------------------------------------------
+void powerBoot(void) {
+	powerHold();
+	if (power_state.magic == POWER_MAGIC && power_state.sleeping == 1 && rcu_flag_get(RCU_FLAG_FWDGTRST) == SET) {
+		powerDeepSleep();
+		rcu_all_reset_flag_clear();
+	}
+	power_state.magic = POWER_MAGIC;
+	power_state.sleeping = 0;
+}
+
+// #POWER# -----------------------------------------------------
+// Description....: :   (PIN_SELF_HOLD),   (PIN_POWER)
+// Argument.......: 
+// ------------------------------------------------------------
+void powerInit(void) {
+	powerHold();
+	power_activity = millis();
+}
+
+// #POWER# -----------------------------------------------------
+// Description....:  :       
+//									POWER_IDLE_MS -   .   POWER_TASK_MS
+// Argument.......: 
+// ------------------------------------------------------------
+void powerTask(void) {
+	uint32_t now = millis();
+	if (engineEnabled() == SET || digitalRead(PIN_POWER) == POWER_BUTTON_ACTIVE) power_activity = now;
+	if (now - power_activity >= POWER_IDLE_MS) powerSleep();
+}
+
+// #POWER# -----------------------------------------------------
+// Description....:  (deep-sleep)   .     ,
+//									     fw_init()
+// Argument.......: 
+// ------------------------------------------------------------
+void powerSleep(void) {
+	engineMode(RESET);
+	batterySave();
+	power_state.magic = POWER_MAGIC;
+	power_state.sleeping = 1;
+	powerDeepSleep();
+	power_state.sleeping = 0;
+	power_activity = millis();
+}
+
+// #POWER# -----------------------------------------------------
+// Description....:   (  PIN_SELF_HOLD)
+// Argument.......: 
+// ------------------------------------------------------------
+void powerOff(void) {
+	engineMode(RESET);
+	batterySave();
+	power_state.sleeping = 0;
+	digitalWrite(PIN_SELF_HOLD, LOW);
+	while (1) fwdgt_counter_reload();
+}
@@ -0,0 +1,56 @@
+// #INDEX# ======================================================================================================
+// Title .........:  :  ,   ,  
+// Arch ..........: GD32F130C8C6
+// Author ........: GreenBytes ( https://vk.com/greenbytes )
+// Version .......: 1.0.0.0
+// ==============================================================================================================
+
+#ifndef POWER_H
+
+	#define POWER_H
+
+	//  
+	//      
+	#include "gd32f1x0.h"
+
+	//  
+	#include "../framework/framework.h"
+	//    
+	#include "../define.h"
+
+	// #POWER# -----------------------------------------------------
+	// Description....:  :    main(),  fw_init()
+	//									           (
+	//									 ),       
+	//									   .     , 
+	//									faultResetCause()      
+	// Argument.......: 
+	// ------------------------------------------------------------
+	void powerBoot(void);
+
+	// #POWER# -----------------------------------------------------
+	// Description....: :   (PIN_SELF_HOLD),   (PIN_POWER)
+	// Argument.......: 
+	// ------------------------------------------------------------
+	void powerInit(void);
+
+	// #POWER# -----------------------------------------------------
+	// Description....:  :       
+	//									POWER_IDLE_MS -   .   POWER_TASK_MS
+	// Argument.......: 
+	// ------------------------------------------------------------
+	void powerTask(void);
+
+	// #POWER# -----------------------------------------------------
+	// Description....:  (deep-sleep)   .     ,
+	//									     fw_init()
+	// Argument.......: 
+	// ------------------------------------------------------------
+	void powerSleep(void);
+
+	// #POWER# -----------------------------------------------------
+	// Description....:   (  PIN_SELF_HOLD)
+	// Argument.......: 
+	// ------------------------------------------------------------
+	void powerOff(void);
+#endif
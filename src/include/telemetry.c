@@ -0,0 +1,127 @@
+// #INDEX# ======================================================================================================
+// Title .........: :     (COBS, CRC-16)  DMA
+// Arch ..........: GD32F130C8C6
+// Author ........: GreenBytes ( https://vk.com/greenbytes )
+// Version .......: 1.0.0.0
+// ==============================================================================================================
+
+//  
+//      
+#include "gd32f1x0.h"
+//  
+#include "telemetry.h"
+//   ,    
+#include "bldc.h"
+#include "battery.h"
+#include "derate.h"
+//  
+#include "../framework/framework.h"
+#include "../framework/scheduler.h"
+#include "../framework/serial.h"
+#include "../framework/frame.h"
+#include "../framework/fault.h"
+#include "../framework/supervisor.h"
+//    
+#include "../define.h"
+
+//    :  3 ,  15 , CRC 2 
+# define TELEMETRY_RAW_SIZE							20
+# define TELEMETRY_TX_SIZE							FRAME_COBS_SIZE(TELEMETRY_RAW_SIZE)
+
+//      (  DMA,  serialBusy())
+uint8_t telemetry_raw[TELEMETRY_RAW_SIZE];
+uint8_t telemetry_tx[TELEMETRY_TX_SIZE];
+//    (TELEMETRY_F_*)
+uint8_t telemetry_fields = TELEMETRY_FIELDS;
+//    
+uint8_t telemetry_seq = 0;
+uint32_t telemetry_drops = 0;
+//     (   )
+uint8_t telemetry_bootFaults = 0;
+
+// #TELEMETRY# ------------------------------------------------
+// Description....:     
+// Argument.......:
+//      uint8_t *DST								=   
+//      uint16_t VALUE							= 
+// ------------------------------------------------------------
+static uint8_t *telemetryPut16(uint8_t *DST, uint16_t VALUE) {
+	DST[0] = (uint8_t)VALUE;
+	DST[1] = (uint8_t)(VALUE >> 8);
+	return DST + 2;
+}
+
+// #TELEMETRY# ------------------------------------------------
+// Description....:      ( , TELEMETRY_PERIOD_MS)
+//									  ,   -    
+// Argument.......: 
+// ------------------------------------------------------------
+static void telemetryTask(void) {
+	bldcState state;
+	uint8_t *dst = telemetry_raw;
+	uint8_t faults = telemetry_bootFaults;
+	int32_t curr;
+	if (serialBusy(SERIAL_AUX) == SET) {
+		telemetry_drops++;
+		return;
+	}
+	engineSnapshot(&state);
+	*dst++ = TELEMETRY_TYPE_STATE;
+	*dst++ = telemetry_seq++;
+	*dst++ = telemetry_fields;
+	if (telemetry_fields & TELEMETRY_F_DUTY) dst = telemetryPut16(dst, (uint16_t)state.duty);
+	if (telemetry_fields & TELEMETRY_F_SPEED) dst = telemetryPut16(dst, (uint16_t)MAX(state.speed, 0xFFFF));
+	if (telemetry_fields & TELEMETRY_F_HALL) *dst++ = (uint8_t)((state.hall & 0x07) | (state.pos << 4));
+	if (telemetry_fields & TELEMETRY_F_VOLT) dst = telemetryPut16(dst, batteryVoltage());
+	if (telemetry_fields & TELEMETRY_F_CURR) {
+		curr = batteryCurrent();
+		dst = telemetryPut16(dst, (uint16_t)(int16_t)CLAMP(curr, -32767, 32767));
+	}
+	if (telemetry_fields & TELEMETRY_F_FAULT) {
+		if (engineHallFault() == SET) faults |= TELEMETRY_FAULT_HALL;
+		if (derateLimit() < 1000) faults |= TELEMETRY_FAULT_DERATE;
+		dst = telemetryPut16(dst, (uint16_t)(faults | ((uint16_t)faultResetCause() << 8)));
+	}
+	if (telemetry_fields & TELEMETRY_F_SOC) dst = telemetryPut16(dst, batterySoc());
+	if (telemetry_fields & TELEMETRY_F_LIMIT) dst = telemetryPut16(dst, derateLimit());
+	serialSend(SERIAL_AUX, telemetry_tx, frameEncode(telemetry_raw, (uint16_t)(dst - telemetry_raw), telemetry_tx));
+}
+
+// #TELEMETRY# ------------------------------------------------
+// Description....:     ( )
+// Argument.......: 
+// ------------------------------------------------------------
+static void telemetryStart(void) {
+	if (faultLastDump() != NULL) telemetry_bootFaults |= TELEMETRY_FAULT_CRASH;
+	if (supLastFault() != NULL) telemetry_bootFaults |= TELEMETRY_FAULT_WATCHDOG;
+	serialInit(SERIAL_AUX, AUX_BAUD, SERIAL_MODE_FULL);
+	schedAdd(telemetryTask, TELEMETRY_PERIOD_MS, SCHED_PRIO_LOW);
+}
+
+// #TELEMETRY# ------------------------------------------------
+// Description....: :       (bootDefer),
+//									    .   fw_init()  engineInit()
+//									  ,      (AUX_PROTOCOL)
+// Argument.......: 
+// ------------------------------------------------------------
+void telemetryInit(void) {
+	if (AUX_PROTOCOL != AUX_PROTOCOL_FRAME) return;
+	bootDefer(telemetryStart);
+}
+
+// #TELEMETRY# ------------------------------------------------
+// Description....:     (  TELEMETRY_FIELDS)
+// Argument.......:
+//      uint8_t FIELDS							=   TELEMETRY_F_*
+// ------------------------------------------------------------
+void telemetryFields(uint8_t FIELDS) {
+	telemetry_fields = FIELDS;
+}
+
+// #TELEMETRY# ------------------------------------------------
+// Description....:    (   )
+// Argument.......: 
+// ------------------------------------------------------------
+uint32_t telemetryDrops(void) {
+	return telemetry_drops;
+}
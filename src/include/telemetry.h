@@ -0,0 +1,67 @@
+// #INDEX# ======================================================================================================
+// Title .........: :     (COBS, CRC-16)  DMA
+// Arch ..........: GD32F130C8C6
+// Author ........: GreenBytes ( https://vk.com/greenbytes )
+// Version .......: 1.0.0.0
+// ==============================================================================================================
+
+#ifndef TELEMETRY_H
+
+	#define TELEMETRY_H
+
+	//  
+	//      
+	#include "gd32f1x0.h"
+
+	//  
+	#include "../framework/framework.h"
+	//    
+	#include "../define.h"
+
+	// : , ,  ,      (  ), CRC-16
+	//   
+	# define TELEMETRY_TYPE_STATE					0x01
+	//  ( TELEMETRY_FIELDS  define.h)
+	// int16_t  ()
+	# define TELEMETRY_F_DUTY							BIT(0)
+	// uint16_t  (. /,  )
+	# define TELEMETRY_F_SPEED						BIT(1)
+	// uint8_t    ( 0..2)    ( 4..7)
+	# define TELEMETRY_F_HALL							BIT(2)
+	// uint16_t   ()
+	# define TELEMETRY_F_VOLT							BIT(3)
+	// int16_t   (,  )
+	# define TELEMETRY_F_CURR							BIT(4)
+	// uint16_t :   - TELEMETRY_FAULT_*,  -   FAULT_RESET_*
+	# define TELEMETRY_F_FAULT						BIT(5)
+	// uint16_t  (0.01%)
+	# define TELEMETRY_F_SOC							BIT(6)
+	// uint16_t   ()
+	# define TELEMETRY_F_LIMIT						BIT(7)
+	//  
+	# define TELEMETRY_FAULT_HALL					BIT(0)
+	# define TELEMETRY_FAULT_DERATE				BIT(1)
+	# define TELEMETRY_FAULT_CRASH				BIT(2)
+	# define TELEMETRY_FAULT_WATCHDOG			BIT(3)
+
+	// #TELEMETRY# ------------------------------------------------
+	// Description....: :       (bootDefer),
+	//									    .   fw_init()  engineInit()
+	//									  ,      (AUX_PROTOCOL)
+	// Argument.......: 
+	// ------------------------------------------------------------
+	void telemetryInit(void);
+
+	// #TELEMETRY# ------------------------------------------------
+	// Description....:     (  TELEMETRY_FIELDS)
+	// Argument.......:
+	//      uint8_t FIELDS							=   TELEMETRY_F_*
+	// ------------------------------------------------------------
+	void telemetryFields(uint8_t FIELDS);
+
+	// #TELEMETRY# ------------------------------------------------
+	// Description....:    (   )
+	// Argument.......: 
+	// ------------------------------------------------------------
+	uint32_t telemetryDrops(void);
+#endif
@@ -0,0 +1,123 @@
+// #INDEX# ======================================================================================================
+// Title .........:   (I2t)     
+// Arch ..........: GD32F130C8C6
+// Author ........: GreenBytes ( https://vk.com/greenbytes )
+// Version .......: 1.0.0.0
+// ==============================================================================================================
+
+//  
+//      
+#include "gd32f1x0.h"
+//   
+#include "thermal.h"
+//     
+#include "battery.h"
+#include "bldc.h"
+//  
+#include "../framework/framework.h"
+//    
+#include "../define.h"
+
+//    Q24: 1.0 -      
+# define THERMAL_ONE										((int32_t)1 << 24)
+//       (Q12),     int32_t  Q24
+# define THERMAL_RATIO_MAX							((int32_t)8 << 12)
+//     
+# define THERMAL_MAGIC									0x54484D31
+//     (Q24)
+# define THERMAL_START									((int32_t)((int64_t)THERMAL_ONE * THERMAL_DERATE_START / 100))
+
+//      
+typedef struct {
+	uint32_t magic;
+	int32_t heat[THERMAL_COUNT];
+	uint32_t check;
+} thermalState;
+
+NOINIT thermalState thermal_state;
+
+//    ()  1/tau (Q24  ) 
+const int32_t thermal_currMax[THERMAL_COUNT] = { THERMAL_WINDING_MA, THERMAL_BRIDGE_MA };
+const int32_t thermal_rate[THERMAL_COUNT] =
+		{
+			(int32_t)(THERMAL_ONE / (THERMAL_WINDING_TAU_S * 1000L)),
+			(int32_t)(THERMAL_ONE / (THERMAL_BRIDGE_TAU_S * 1000L))
+		};
+
+//    ()
+uint32_t thermal_lastTick = 0;
+
+// #THERMAL# ---------------------------------------------------
+// Description....:   
+// Argument.......: 
+// ------------------------------------------------------------
+static uint32_t thermalCheck(void) {
+	uint32_t sum = thermal_state.magic;
+	uint8_t i;
+	for (i = 0; i < THERMAL_COUNT; i++) sum = ((sum << 5) | (sum >> 27)) ^ (uint32_t)thermal_state.heat[i];
+	return ~sum;
+}
+
+// #THERMAL# ---------------------------------------------------
+// Description....: :       
+//									  ,      
+// Argument.......: 
+// ------------------------------------------------------------
+void thermalInit(void) {
+	uint8_t i;
+	if (thermal_state.magic != THERMAL_MAGIC || thermal_state.check != thermalCheck()) {
+		thermal_state.magic = THERMAL_MAGIC;
+		for (i = 0; i < THERMAL_COUNT; i++) thermal_state.heat[i] = 0;
+		thermal_state.check = thermalCheck();
+	}
+	thermal_lastTick = millis();
+}
+
+// #THERMAL# ---------------------------------------------------
+// Description....:        (  derateTask())
+//									      / ,  
+//									 (I / I)^2    
+// Argument.......: 
+// ------------------------------------------------------------
+void thermalTask(void) {
+	int32_t duty, phase, ratio, load;
+	uint32_t now = millis();
+	uint32_t dt = now - thermal_lastTick;
+	uint8_t i;
+	thermal_lastTick = now;
+	//     1  (    )
+	dt = MAX(dt, 1000);
+	duty = ABS(engineDuty());
+	duty = CLAMP(duty, THERMAL_DUTY_MIN, 1000);
+	phase = ABS(batteryCurrent()) * 1000 / duty;
+	for (i = 0; i < THERMAL_COUNT; i++) {
+		ratio = (int32_t)(((int64_t)phase << 12) / thermal_currMax[i]);
+		ratio = MAX(ratio, THERMAL_RATIO_MAX);
+		load = ratio * ratio;
+		thermal_state.heat[i] += (int32_t)(((int64_t)(load - thermal_state.heat[i]) * thermal_rate[i] * (int32_t)dt) >> 24);
+	}
+	thermal_state.check = thermalCheck();
+}
+
+// #THERMAL# ---------------------------------------------------
+// Description....:   (%, 100 -  )
+// Argument.......:
+//      uint8_t COMPONENT						=  (THERMAL_WINDING, THERMAL_BRIDGE)
+// ------------------------------------------------------------
+uint16_t thermalLoad(uint8_t COMPONENT) {
+	if (COMPONENT >= THERMAL_COUNT) return 0;
+	return (uint16_t)(((int64_t)thermal_state.heat[COMPONENT] * 100) >> 24);
+}
+
+// #THERMAL# ---------------------------------------------------
+// Description....:     ():   THERMAL_DERATE_START
+//									        
+// Argument.......: 
+// ------------------------------------------------------------
+int32_t thermalLimit(void) {
+	int32_t heat = thermal_state.heat[THERMAL_WINDING];
+	if (thermal_state.heat[THERMAL_BRIDGE] > heat) heat = thermal_state.heat[THERMAL_BRIDGE];
+	if (heat <= THERMAL_START) return 1000;
+	if (heat >= THERMAL_ONE) return 0;
+	return (int32_t)((int64_t)(THERMAL_ONE - heat) * 1000 / (THERMAL_ONE - THERMAL_START));
+}
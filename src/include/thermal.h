@@ -0,0 +1,56 @@
+// #INDEX# ======================================================================================================
+// Title .........:   (I2t)     
+// Arch ..........: GD32F130C8C6
+// Author ........: GreenBytes ( https://vk.com/greenbytes )
+// Version .......: 1.0.0.0
+// ==============================================================================================================
+
+#ifndef THERMAL_H
+
+	#define THERMAL_H
+
+	//  
+	//      
+	#include "gd32f1x0.h"
+
+	//  
+	#include "../framework/framework.h"
+	//    
+	#include "../define.h"
+
+	// 
+	//  
+	//  
+	# define THERMAL_WINDING				0
+	//   (MOSFET)
+	# define THERMAL_BRIDGE					1
+	//  
+	# define THERMAL_COUNT					2
+
+	// #THERMAL# ---------------------------------------------------
+	// Description....: :       
+	//									  ,      
+	// Argument.......: 
+	// ------------------------------------------------------------
+	void thermalInit(void);
+
+	// #THERMAL# ---------------------------------------------------
+	// Description....:        (  derateTask())
+	// Argument.......: 
+	// ------------------------------------------------------------
+	void thermalTask(void);
+
+	// #THERMAL# ---------------------------------------------------
+	// Description....:   (%, 100 -  )
+	// Argument.......:
+	//      uint8_t COMPONENT						=  (THERMAL_WINDING, THERMAL_BRIDGE)
+	// ------------------------------------------------------------
+	uint16_t thermalLoad(uint8_t COMPONENT);
+
+	// #THERMAL# ---------------------------------------------------
+	// Description....:     ():   THERMAL_DERATE_START
+	//									        
+	// Argument.......: 
+	// ------------------------------------------------------------
+	int32_t thermalLimit(void);
+#endif